@@ -0,0 +1,161 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <functional>
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include "../Board/Board.h"
+
+struct BenchRecord {
+    std::string name;
+    int width;
+    int height;
+    int k;
+    double density;
+    long long ops;
+    double nsPerOp;
+};
+
+static volatile long long sink = 0;
+
+static double measure(const std::function<long long()>& body, double minMillis, long long& ops) {
+    using clock = std::chrono::steady_clock;
+    ops = 0;
+    auto start = clock::now();
+    double elapsed = 0;
+    do {
+        ops += body();
+        elapsed = std::chrono::duration<double, std::milli>(clock::now() - start).count();
+    } while (elapsed < minMillis);
+    return elapsed * 1e6 / static_cast<double>(ops);
+}
+
+static Board filledBoard(int w, int h, int k, double density, uint64_t seed) {
+    Board b(w, h, '*', k);
+    std::mt19937_64 rng(seed);
+    std::vector<int> cells(static_cast<size_t>(w) * h);
+    for (size_t c = 0; c < cells.size(); ++c)
+        cells[c] = static_cast<int>(c);
+    std::shuffle(cells.begin(), cells.end(), rng);
+    int counter = 0;
+    size_t stones = static_cast<size_t>(density * cells.size());
+    for (size_t n = 0; n < stones; ++n)
+        b.place(counter, cells[n] / w, cells[n] % w);
+    return b;
+}
+
+int main(int argc, char* argv[]) {
+    uint64_t seed = 12345;
+    bool quick = false;
+    std::string outPath;
+    double minMillis = 100;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "-seed" && i + 1 < argc)
+            seed = std::strtoull(argv[++i], nullptr, 10);
+        else if (arg == "-quick")
+            quick = true;
+        else if (arg == "-out" && i + 1 < argc)
+            outPath = argv[++i];
+        else if (arg == "-ms" && i + 1 < argc)
+            minMillis = std::atof(argv[++i]);
+    }
+
+    std::vector<std::pair<int, int>> sizes = { {3, 3}, {15, 15}, {100, 100}, {1000, 1000} };
+    if (quick)
+        sizes.pop_back();
+    const double densities[] = { 0.0, 0.1, 0.5, 0.9 };
+    std::vector<BenchRecord> records;
+    long long ops;
+
+    for (auto& size : sizes) {
+        int w = size.first, h = size.second;
+        size_t cells = static_cast<size_t>(w) * h;
+
+        double ns = measure([&] { Board b(w, h); sink += b.width(); return 1LL; }, minMillis, ops);
+        records.push_back({ "construct", w, h, 3, 0.0, ops, ns });
+
+        std::mt19937_64 rng(seed);
+        std::vector<int> order(cells);
+        for (size_t c = 0; c < cells; ++c)
+            order[c] = static_cast<int>(c);
+        std::shuffle(order.begin(), order.end(), rng);
+        long long placed = 0;
+        double total = 0;
+        auto start = std::chrono::steady_clock::now();
+        while (total < minMillis) {
+            Board b(w, h, '*', 5);
+            int counter = 0;
+            auto t0 = std::chrono::steady_clock::now();
+            for (int c : order)
+                sink += b.place(counter, c / w, c % w);
+            total += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+            placed += static_cast<long long>(cells);
+            if (std::chrono::steady_clock::now() - start > std::chrono::seconds(30))
+                break;
+        }
+        records.push_back({ "place", w, h, 5, 1.0, placed, total * 1e6 / placed });
+
+        for (double density : densities) {
+            Board b = filledBoard(w, h, 3, density, seed);
+            for (int k = 3; k <= 6; ++k) {
+                if (k > w && k > h)
+                    continue;
+                ns = measure([&] { sink += b.checkWinCondition(k); return 1LL; }, minMillis, ops);
+                records.push_back({ "checkWinCondition", w, h, k, density, ops, ns });
+            }
+        }
+
+        Board half = filledBoard(w, h, 3, 0.5, seed);
+        ns = measure([&] {
+            long long hits = 0;
+            for (int i = -1; i <= h; ++i)
+                for (int j = -1; j <= w; ++j)
+                    hits += half.inBounds(i, j);
+            sink += hits;
+            return static_cast<long long>(w + 2) * (h + 2);
+        }, minMillis, ops);
+        records.push_back({ "inBounds", w, h, 3, 0.5, ops, ns });
+
+        ns = measure([&] {
+            long long free = 0;
+            for (int i = 0; i < h; ++i)
+                for (int j = 0; j < w; ++j)
+                    free += half.checkCellAccess(i, j);
+            sink += free;
+            return static_cast<long long>(cells);
+        }, minMillis, ops);
+        records.push_back({ "checkCellAccess", w, h, 3, 0.5, ops, ns });
+
+        ns = measure([&] {
+            std::ostringstream out;
+            out << half;
+            sink += static_cast<long long>(out.str().size());
+            return 1LL;
+        }, minMillis, ops);
+        records.push_back({ "render", w, h, 3, 0.5, ops, ns });
+    }
+
+    std::ostringstream json;
+    json << "{\n  \"seed\": " << seed << ",\n  \"results\": [\n";
+    for (size_t n = 0; n < records.size(); ++n) {
+        const BenchRecord& r = records[n];
+        json << "    {\"name\": \"" << r.name << "\", \"width\": " << r.width << ", \"height\": " << r.height
+            << ", \"k\": " << r.k << ", \"density\": " << r.density << ", \"ops\": " << r.ops
+            << ", \"ns_per_op\": " << r.nsPerOp << "}" << (n + 1 < records.size() ? "," : "") << "\n";
+    }
+    json << "  ]\n}\n";
+
+    if (outPath.empty())
+        std::cout << json.str();
+    else {
+        std::ofstream out(outPath);
+        out << json.str();
+    }
+    return 0;
+}
@@ -0,0 +1,76 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdlib>
+#include "../Engine/Engine.h"
+
+struct BenchPosition {
+    std::string name;
+    int width;
+    int height;
+    int k;
+    std::vector<std::pair<int, int>> moves;
+    int maxDepth;
+};
+
+static std::vector<BenchPosition> standardSuite() {
+    return {
+        { "3x3 empty", 3, 3, 3, {}, 9 },
+        { "4x4 opening", 4, 4, 3, { {1, 1}, {2, 2} }, 8 },
+        { "5x5 k4", 5, 5, 4, { {2, 2}, {1, 1}, {2, 3} }, 7 },
+        { "6x6 k4", 6, 6, 4, { {2, 2}, {3, 3}, {2, 3}, {3, 2} }, 6 },
+        { "15x15 k5 middle", 15, 15, 5, { {7, 7}, {7, 8}, {8, 8}, {6, 6}, {8, 7}, {9, 9}, {6, 8} }, 4 },
+    };
+}
+
+static SearchResult runPosition(const BenchPosition& pos, int threads, bool deterministic) {
+    Board board(pos.width, pos.height, '*', pos.k);
+    int counter = 0;
+    for (auto& m : pos.moves)
+        board.place(counter, m.first, m.second);
+
+    Engine engine;
+    SearchLimits limits;
+    limits.maxDepth = pos.maxDepth;
+    limits.threads = threads;
+    limits.deterministic = deterministic;
+    return engine.search(board, counter, limits);
+}
+
+int main(int argc, char* argv[]) {
+    int threads = static_cast<int>(std::thread::hardware_concurrency());
+    bool deterministic = false;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "-threads" && i + 1 < argc)
+            threads = std::atoi(argv[++i]);
+        else if (arg == "-deterministic")
+            deterministic = true;
+    }
+    if (threads < 1)
+        threads = 1;
+
+    std::cout << std::left << std::setw(18) << "position" << std::right
+        << std::setw(6) << "depth" << std::setw(12) << "nodes(1)" << std::setw(12) << "knps(1)"
+        << std::setw(12) << "nodes(N)" << std::setw(12) << "knps(N)" << std::setw(10) << "speedup" << '\n';
+
+    double totalSingle = 0, totalParallel = 0;
+    for (const BenchPosition& pos : standardSuite()) {
+        SearchResult single = runPosition(pos, 1, false);
+        SearchResult parallel = runPosition(pos, threads, deterministic);
+        totalSingle += single.millis;
+        totalParallel += parallel.millis;
+
+        std::cout << std::left << std::setw(18) << pos.name << std::right << std::fixed << std::setprecision(2)
+            << std::setw(6) << parallel.depth
+            << std::setw(12) << single.nodes << std::setw(12) << single.nodesPerSecond / 1000
+            << std::setw(12) << parallel.nodes << std::setw(12) << parallel.nodesPerSecond / 1000
+            << std::setw(10) << (parallel.millis > 0 ? single.millis / parallel.millis : 0.0) << '\n';
+    }
+    std::cout << "threads: " << threads << (deterministic ? " (deterministic)" : "")
+        << ", total speedup: " << std::fixed << std::setprecision(2)
+        << (totalParallel > 0 ? totalSingle / totalParallel : 0.0) << '\n';
+    return 0;
+}
@@ -0,0 +1,123 @@
+#pragma once
+#include <bitset>
+#include <iostream>
+#include <stdexcept>
+#include <cstdint>
+#include "Board.h"
+
+template <int W, int H>
+class BitBoard {
+    static_assert(W >= 1 && H >= 1, "board must not be empty");
+    static_assert((W + 1) * H <= 128, "BitBoard is limited to 128 bits including padding");
+
+public:
+    static constexpr int STRIDE = W + 1;
+    static constexpr int BITS = STRIDE * H;
+    using Bits = std::bitset<BITS>;
+
+    explicit BitBoard(char fill = '*', int k = 3) : fill_(fill), k_(k < 3 ? 3 : k), hash_(0) {}
+
+    int width() const { return W; }
+    int height() const { return H; }
+
+    bool inBounds(int i, int j) const {
+        return i >= 0 && i < H && j >= 0 && j < W;
+    }
+
+    bool checkCellAccess(int i, int j) const {
+        return inBounds(i, j) && !(x_ | o_).test(index(i, j));
+    }
+
+    char at(int i, int j) const {
+        if (x_.test(index(i, j))) return 'X';
+        if (o_.test(index(i, j))) return 'O';
+        return fill_;
+    }
+
+    char place(int& whoseMoveCounter, int i, int j) {
+        if (!checkCellAccess(i, j)) throw std::logic_error("     ");
+
+        bool xMove = (whoseMoveCounter % 2 == 0);
+        Bits& own = xMove ? x_ : o_;
+        own.set(index(i, j));
+        hash_ ^= Board::zobristKey(i * W + j, xMove ? 'X' : 'O');
+        ++whoseMoveCounter;
+        //  2k-1     ,         
+        if (whoseMoveCounter >= 2 * k_ - 1 && hasLine(own, k_))
+            return xMove ? 'X' : 'O';
+        if (!hasEmptyCells())
+            return 'D';
+        return '*';
+    }
+
+    void unplace(int& whoseMoveCounter, int i, int j) {
+        if (!inBounds(i, j) || checkCellAccess(i, j)) throw std::logic_error("      ");
+
+        int bit = index(i, j);
+        hash_ ^= Board::zobristKey(i * W + j, x_.test(bit) ? 'X' : 'O');
+        x_.reset(bit);
+        o_.reset(bit);
+        --whoseMoveCounter;
+    }
+
+    //    ,    Board,      
+    uint64_t hash() const { return hash_; }
+
+    int winLength() const { return k_; }
+
+    char checkWinCondition(int k = 3) const {
+        if (k < 3) k = 3;
+
+        if (!hasEmptyCells()) {
+            return 'D';
+        }
+        if (hasLine(x_, k)) return 'X';
+        if (hasLine(o_, k)) return 'O';
+        return '*';
+    }
+
+    int filledCells() const {
+        return static_cast<int>((x_ | o_).count());
+    }
+
+    const Bits& xBits() const { return x_; }
+    const Bits& oBits() const { return o_; }
+
+    friend std::ostream& operator<<(std::ostream& os, const BitBoard& b) {
+        for (int i = 0; i < H; ++i) {
+            for (int j = 0; j < W; ++j) {
+                os << b.at(i, j);
+                if (j + 1 < W) os << ' ';
+            }
+            os << '\n';
+        }
+        return os;
+    }
+
+private:
+    Bits x_;
+    Bits o_;
+    char fill_;
+    int k_;
+    uint64_t hash_;
+
+    static int index(int i, int j) {
+        return i * STRIDE + j;
+    }
+
+    bool hasEmptyCells() const {
+        return filledCells() < W * H;
+    }
+
+    static bool hasLine(const Bits& b, int k) {
+        static const int shifts[4] = { 1, STRIDE, STRIDE + 1, STRIDE - 1 };
+        for (int d : shifts) {
+            Bits m = b;
+            for (int step = 1; step < k && m.any(); ++step)
+                m &= b >> (step * d);
+            if (m.any())
+                return true;
+        }
+        return false;
+    }
+};
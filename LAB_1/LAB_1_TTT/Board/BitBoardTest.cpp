@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <iostream>
+#include <random>
+#include "Board.h"
+#include "BitBoard.h"
+
+template <typename B>
+static char playMoves(B& b, const std::vector<std::pair<int, int>>& moves) {
+    int counter = 0;
+    char result = '*';
+    for (const auto& m : moves)
+        result = b.place(counter, m.first, m.second);
+    return result;
+}
+
+TEST(BitBoardTest, EmptyBoard) {
+    BitBoard<3, 3> b;
+    EXPECT_EQ(b.width(), 3);
+    EXPECT_EQ(b.height(), 3);
+    EXPECT_TRUE(b.checkCellAccess(1, 1));
+    EXPECT_FALSE(b.checkCellAccess(3, 0));
+    EXPECT_EQ(b.at(0, 0), '*');
+    EXPECT_EQ(b.checkWinCondition(), '*');
+}
+
+TEST(BitBoardTest, PlaceAlternatesPlayers) {
+    BitBoard<3, 3> b;
+    int counter = 0;
+    b.place(counter, 0, 0);
+    b.place(counter, 1, 1);
+    EXPECT_EQ(b.at(0, 0), 'X');
+    EXPECT_EQ(b.at(1, 1), 'O');
+    EXPECT_EQ(counter, 2);
+    EXPECT_THROW(b.place(counter, 0, 0), std::logic_error);
+    EXPECT_THROW(b.place(counter, 3, 3), std::logic_error);
+}
+
+TEST(BitBoardTest, WinsInEveryDirection) {
+    BitBoard<3, 3> h, v, d, a;
+    EXPECT_EQ(playMoves(h, { {0, 0}, {1, 0}, {0, 1}, {1, 1}, {0, 2} }), 'X');
+    EXPECT_EQ(playMoves(v, { {0, 0}, {0, 1}, {1, 0}, {1, 1}, {2, 0} }), 'X');
+    EXPECT_EQ(playMoves(d, { {0, 0}, {0, 1}, {1, 1}, {0, 2}, {2, 2} }), 'X');
+    EXPECT_EQ(playMoves(a, { {0, 2}, {0, 1}, {1, 1}, {0, 0}, {2, 0} }), 'X');
+}
+
+TEST(BitBoardTest, NoWrapAcrossRows) {
+    BitBoard<4, 4> b;
+    EXPECT_EQ(playMoves(b, { {0, 2}, {3, 0}, {0, 3}, {3, 3}, {1, 0} }), '*');
+    BitBoard<4, 4> anti;
+    EXPECT_EQ(playMoves(anti, { {0, 0}, {3, 3}, {1, 3}, {3, 2}, {2, 2} }), '*');
+}
+
+TEST(BitBoardTest, DrawOnFullBoard) {
+    BitBoard<2, 2> b;
+    playMoves(b, { {0, 0}, {0, 1}, {1, 0}, {1, 1} });
+    EXPECT_EQ(b.filledCells(), 4);
+    EXPECT_EQ(b.checkWinCondition(), 'D');
+}
+
+TEST(BitBoardTest, SmallBoardsDrawLikeDynamicBoard) {
+    BitBoard<2, 2> square;
+    Board squareBoard(2, 2);
+    std::vector<std::pair<int, int>> squareMoves{ {0, 0}, {0, 1}, {1, 0}, {1, 1} };
+    EXPECT_EQ(playMoves(square, squareMoves), 'D');
+    EXPECT_EQ(playMoves(squareBoard, squareMoves), 'D');
+
+    BitBoard<5, 1> row('*', 4);
+    Board rowBoard(5, 1, '*', 4);
+    int rowCounter = 0, rowBoardCounter = 0;
+    for (int j : { 0, 1, 2, 4, 3 })
+        EXPECT_EQ(row.place(rowCounter, 0, j), rowBoard.place(rowBoardCounter, 0, j)) << j;
+    EXPECT_EQ(rowBoard.state(), 'D');
+}
+
+TEST(BitBoardTest, UnplaceRestoresCellAndHash) {
+    BitBoard<3, 3> b;
+    int counter = 0;
+    b.place(counter, 1, 1);
+    uint64_t afterFirst = b.hash();
+    b.place(counter, 0, 2);
+    EXPECT_NE(b.hash(), afterFirst);
+
+    b.unplace(counter, 0, 2);
+    EXPECT_EQ(counter, 1);
+    EXPECT_EQ(b.hash(), afterFirst);
+    EXPECT_TRUE(b.checkCellAccess(0, 2));
+    EXPECT_EQ(b.at(0, 2), '*');
+    EXPECT_THROW(b.unplace(counter, 0, 2), std::logic_error);
+
+    b.unplace(counter, 1, 1);
+    EXPECT_EQ(b.hash(), 0u);
+    EXPECT_EQ(b.filledCells(), 0);
+}
+
+TEST(BitBoardTest, OutputMatchesDynamicBoard) {
+    BitBoard<3, 2> bits;
+    Board board(3, 2);
+    playMoves(bits, { {0, 0}, {1, 2} });
+    playMoves(board, { {0, 0}, {1, 2} });
+    std::stringstream a, b;
+    a << bits;
+    b << board;
+    EXPECT_EQ(a.str(), b.str());
+}
+
+TEST(BitBoardTest, LargestBoardFits) {
+    BitBoard<10, 11> b;
+    EXPECT_EQ(playMoves(b, { {10, 5}, {0, 0}, {10, 6}, {0, 1}, {10, 7} }), 'X');
+}
+
+TEST(BitBoardTest, MatchesDynamicBoardOnRandomGames) {
+    std::mt19937 rng(42);
+    for (int game = 0; game < 200; ++game) {
+        BitBoard<7, 6> bits;
+        Board board(7, 6);
+        int bitsCounter = 0, boardCounter = 0;
+        for (int move = 0; move < 42; ++move) {
+            int i, j;
+            do {
+                i = static_cast<int>(rng() % 6);
+                j = static_cast<int>(rng() % 7);
+            } while (!board.checkCellAccess(i, j));
+            char expected = board.place(boardCounter, i, j);
+            ASSERT_EQ(bits.place(bitsCounter, i, j), expected);
+            ASSERT_EQ(bits.hash(), board.hash());
+            for (int k = 3; k <= 5; ++k)
+                ASSERT_EQ(bits.checkWinCondition(k), board.checkWinCondition(k));
+            if (expected != '*')
+                break;
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -1,116 +1,369 @@
 #include "Board.h"
 #include <algorithm>
+#include <cstring>
 
-Board::Board(int w, int h, char fill) {
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define BOARD_SSE2 1
+#endif
+
+namespace {
+
+//     16 ,        .
+const int ROW_ALIGN = 16;
+
+bool matchBytes(const char* row, char symbol, uint8_t* mask, int n) {
+    int j = 0;
+    int any = 0;
+#ifdef BOARD_SSE2
+    const __m128i s = _mm_set1_epi8(symbol);
+    for (; j + 16 <= n; j += 16) {
+        __m128i eq = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(row + j)), s);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(mask + j), eq);
+        any |= _mm_movemask_epi8(eq);
+    }
+#endif
+    for (; j < n; ++j) {
+        mask[j] = row[j] == symbol ? 0xFF : 0;
+        any |= mask[j];
+    }
+    return any != 0;
+}
+
+// next[j] = (prev[j] + 1) & mask[j];    .
+uint8_t extendRuns(const uint8_t* mask, const uint8_t* prev, uint8_t* next, int n) {
+    int j = 0;
+    uint8_t top = 0;
+#ifdef BOARD_SSE2
+    const __m128i one = _mm_set1_epi8(1);
+    __m128i best = _mm_setzero_si128();
+    for (; j + 16 <= n; j += 16) {
+        __m128i p = _mm_loadu_si128(reinterpret_cast<const __m128i*>(prev + j));
+        __m128i m = _mm_loadu_si128(reinterpret_cast<const __m128i*>(mask + j));
+        __m128i r = _mm_and_si128(_mm_adds_epu8(p, one), m);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(next + j), r);
+        best = _mm_max_epu8(best, r);
+    }
+    uint8_t lanes[16];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), best);
+    for (uint8_t lane : lanes)
+        top = std::max(top, lane);
+#endif
+    for (; j < n; ++j) {
+        uint8_t r = static_cast<uint8_t>((prev[j] == 0xFF ? 0xFF : prev[j] + 1) & mask[j]);
+        next[j] = r;
+        top = std::max(top, r);
+    }
+    return top;
+}
+
+// a[j] &= a[j + shift];   j     .
+void andShifted(uint8_t* a, int shift, int n) {
+    int j = 0;
+#ifdef BOARD_SSE2
+    for (; j + 16 <= n; j += 16) {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + j));
+        __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + j + shift));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(a + j), _mm_and_si128(x, y));
+    }
+#endif
+    for (; j < n; ++j)
+        a[j] &= a[j + shift];
+}
+
+bool anyPair(const uint8_t* a, int shift, int n) {
+    int j = 0;
+#ifdef BOARD_SSE2
+    for (; j + 16 <= n; j += 16) {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + j));
+        __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + j + shift));
+        if (_mm_movemask_epi8(_mm_and_si128(x, y)))
+            return true;
+    }
+#endif
+    for (; j < n; ++j)
+        if (a[j] & a[j + shift])
+            return true;
+    return false;
+}
+
+}
+
+Board::Board(int w, int h, char fill, int k) : fill_(fill), k_(k < 3 ? 3 : k), filled_(0), hash_(0), listener_(nullptr) {
     if (w < 1 || h < 1) throw std::invalid_argument("       ");
-    grid_.assign(h, std::vector<char>(w, fill));
+    width_ = w;
+    height_ = h;
+    stride_ = (w + ROW_ALIGN - 1) / ROW_ALIGN * ROW_ALIGN;
+    cells_.assign(static_cast<size_t>(stride_) * h, fill);
 }
 
 std::ostream& operator<<(std::ostream& os, const Board& b) {
-    for (int i = 0; i < b.grid_.size(); ++i) {
-        for (int j = 0; j < b.grid_[0].size(); ++j) {
-            os << b.grid_[i][j];
-            if (j + 1 < b.grid_[0].size()) os << ' ';
+    for (int i = 0; i < b.height_; ++i) {
+        const char* row = b[i];
+        for (int j = 0; j < b.width_; ++j) {
+            os << row[j];
+            if (j + 1 < b.width_) os << ' ';
         }
         os << '\n';
     }
     return os;
 }
 
-std::vector<char>& Board::operator[](int i) { 
-    return grid_[i]; 
+char* Board::operator[](int i) {
+    return &cells_[static_cast<size_t>(i) * stride_];
 }
-const std::vector<char>& Board::operator[](int i) const {
-    return grid_[i]; 
+const char* Board::operator[](int i) const {
+    return &cells_[static_cast<size_t>(i) * stride_];
+}
+
+int Board::width() const {
+    return width_;
+}
+
+int Board::height() const {
+    return height_;
+}
+
+char Board::at(int i, int j) const {
+    return cells_[static_cast<size_t>(i) * stride_ + j];
 }
 
 bool Board::inBounds(int i, int j) const {
-    return (i >= 0 && i < grid_.size() && j >= 0 && j < grid_[0].size());
+    return (i >= 0 && i < height_ && j >= 0 && j < width_);
 }
 
 bool Board::checkCellAccess(int i, int j) const {
     if (!inBounds(i, j))
         return false;
-    char c = grid_[i][j];
+    char c = at(i, j);
     return !(c == 'O' || c == 'X');
 }
 
-char Board::place(int& whoseMoveCounter, int i, int j) {
+//      :     ,  undo/redo  
+char Board::makeMove(int& whoseMoveCounter, int i, int j) {
     if (!checkCellAccess(i, j)) throw std::logic_error("     ");
 
-    grid_[i][j] = (whoseMoveCounter % 2 == 0) ? 'X' : 'O';
+    char symbol = (whoseMoveCounter % 2 == 0) ? 'X' : 'O';
+    (*this)[i][j] = symbol;
     ++whoseMoveCounter;
-    if (whoseMoveCounter < 5)
-        return '*';
-    return checkWinCondition(3);
+    ++filled_;
+    hash_ ^= zobristKey(i * width_ + j, symbol);
+    if (listener_)
+        listener_->onPlace(*this, i, j, symbol);
+
+    if (whoseMoveCounter >= 2 * k_ - 1 && checkLinesThrough(i, j, k_))
+        return symbol;
+    if (filled_ == width_ * height_)
+        return 'D';
+    return '*';
 }
 
-char Board::checkWinCondition(int k) const {
-    if (k < 3) k = 3;
+void Board::unmakeMove(int& whoseMoveCounter, int i, int j) {
+    if (!inBounds(i, j) || checkCellAccess(i, j)) throw std::logic_error("      ");
 
-    if (!hasEmptyCells()) {
-        return 'D';
+    hash_ ^= zobristKey(i * width_ + j, at(i, j));
+    (*this)[i][j] = fill_;
+    --whoseMoveCounter;
+    --filled_;
+    if (listener_)
+        listener_->onUnplace(*this, i, j);
+}
+
+char Board::place(int& whoseMoveCounter, int i, int j) {
+    int cell = i * width_ + j;
+    char result = makeMove(whoseMoveCounter, i, j);
+    if (!redo_.empty()) {
+        if (redo_.back() == cell)
+            redo_.pop_back();
+        else
+            redo_.clear();
     }
+    history_.push_back({ cell, result });
+    return result;
+}
+
+void Board::unplace(int& whoseMoveCounter, int i, int j) {
+    unmakeMove(whoseMoveCounter, i, j);
 
-    for (int i = 0; i < grid_.size(); ++i) {
-        for (int j = 0; j < grid_[0].size(); ++j) {
-            char result = checkCellForWin(i, j, k);
-            if (result != '\0') {
-                return result;
+    int cell = i * width_ + j;
+    if (!history_.empty() && history_.back().cell == cell)
+        history_.pop_back();
+    else
+        for (size_t m = history_.size(); m-- > 0;)
+            if (history_[m].cell == cell) {
+                history_.erase(history_.begin() + m);
+                break;
             }
-        }
-    }
+}
 
-    return '*';
+bool Board::undo(int& whoseMoveCounter) {
+    if (history_.empty())
+        return false;
+    int cell = history_.back().cell;
+    unplace(whoseMoveCounter, cell / width_, cell % width_);
+    redo_.push_back(cell);
+    return true;
 }
 
-bool Board::hasEmptyCells() const {
-    for (const auto& row : grid_) {
-        for (char cell : row) {
-            if (cell == '*') {
-                return true;
-            }
-        }
+bool Board::redo(int& whoseMoveCounter) {
+    if (redo_.empty())
+        return false;
+    int cell = redo_.back();
+    place(whoseMoveCounter, cell / width_, cell % width_);
+    return true;
+}
+
+bool Board::canUndo() const {
+    return !history_.empty();
+}
+
+bool Board::canRedo() const {
+    return !redo_.empty();
+}
+
+char Board::state() const {
+    return history_.empty() ? '*' : history_.back().result;
+}
+
+int Board::movesMade() const {
+    return static_cast<int>(history_.size());
+}
+
+void Board::setListener(BoardListener* listener) {
+    listener_ = listener;
+}
+
+BoardListener* Board::listener() const {
+    return listener_;
+}
+
+uint64_t Board::hash() const {
+    return hash_;
+}
+
+uint64_t Board::zobristKey(int cell, char player) {
+    uint64_t z = static_cast<uint64_t>(cell) * 2 + (player == 'O' ? 1 : 0) + 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+int Board::winLength() const {
+    return k_;
+}
+
+int Board::filledCells() const {
+    return filled_;
+}
+
+bool Board::checkLinesThrough(int i, int j, int k) const {
+    static const int directions[4][2] = { {0, 1}, {1, 0}, {1, 1}, {1, -1} };
+
+    char symbol = at(i, j);
+    for (const auto& dir : directions) {
+        int run = 1 + countRun(i, j, dir[0], dir[1], symbol, k - 1);
+        if (run < k)
+            run += countRun(i, j, -dir[0], -dir[1], symbol, k - run);
+        if (run >= k)
+            return true;
     }
     return false;
 }
 
-char Board::checkCellForWin(int i, int j, int k) const {
-    char c = grid_[i][j];
-    if (c == '*' || (c != 'X' && c != 'O')) {
-        return '\0';
+int Board::countRun(int i, int j, int di, int dj, char symbol, int limit) const {
+    int run = 0;
+    for (int step = 1; step <= limit; ++step) {
+        int ni = i + step * di;
+        int nj = j + step * dj;
+        if (!inBounds(ni, nj) || at(ni, nj) != symbol)
+            break;
+        ++run;
     }
+    return run;
+}
 
-    static const int directions[4][2] = { {0, 1}, {1, 0}, {1, 1}, {1, -1} };
+char Board::checkWinCondition(int k) const {
+    if (k < 3) k = 3;
 
-    for (const auto& dir : directions) {
-        if (checkDirection(i, j, dir[0], dir[1], k)) {
-            return c;
-        }
+    if (!hasEmptyCells()) {
+        return 'D';
     }
 
-    return '\0';
+    if (scanForWin('X', k))
+        return 'X';
+    if (scanForWin('O', k))
+        return 'O';
+    return '*';
 }
 
-bool Board::checkDirection(int i, int j, int di, int dj, int k) const {
-    int ei = i + (k - 1) * di;
-    int ej = j + (k - 1) * dj;
+bool Board::hasEmptyCells() const {
+    for (int i = 0; i < height_; ++i) {
+        if (std::memchr((*this)[i], '*', width_))
+            return true;
+    }
+    return false;
+}
 
-    if (!inBounds(ei, ej)) {
+//  :       ,    ,
+//       .
+bool Board::scanForWin(char symbol, int k) const {
+    if (k > width_ && k > height_)
+        return false;
+    if (k > 255) {
+        for (int i = 0; i < height_; ++i)
+            for (int j = 0; j < width_; ++j)
+                if (at(i, j) == symbol && checkLinesThrough(i, j, k))
+                    return true;
         return false;
     }
 
-    return checkSequence(i, j, di, dj, k, grid_[i][j]);
-}
+    const int n = stride_;
+    const size_t bytes = static_cast<size_t>(n) * 8 + 4;
+    uint8_t local[8 * 64 + 4];
+    std::vector<uint8_t> heap;
+    uint8_t* mask = local;
+    if (bytes > sizeof(local)) {
+        heap.resize(bytes);
+        mask = heap.data();
+    }
+    std::memset(mask, 0, bytes);
+    uint8_t* window = mask + n;
+    uint8_t* column = window + 2 * n;
+    uint8_t* diag[2] = { column + n, column + 2 * n + 1 };
+    uint8_t* anti[2] = { column + 3 * n + 2, column + 4 * n + 3 };
+    const bool rows = k <= width_;
+    bool live = false;
 
-bool Board::checkSequence(int i, int j, int di, int dj, int k, char symbol) const {
-    for (int step = 1; step < k; ++step) {
-        int ni = i + step * di;
-        int nj = j + step * dj;
+    for (int i = 0; i < height_; ++i) {
+        bool found = matchBytes((*this)[i], symbol, mask, n);
+        uint8_t* prevDiag = diag[i & 1];
+        uint8_t* nextDiag = diag[(i + 1) & 1];
+        uint8_t* prevAnti = anti[i & 1];
+        uint8_t* nextAnti = anti[(i + 1) & 1];
+        if (!found) {
+            if (live) {
+                std::memset(column, 0, static_cast<size_t>(n) * 5 + 4);
+                live = false;
+            }
+            continue;
+        }
+        live = true;
+        uint8_t top = extendRuns(mask, column, column, n);
+        top = std::max(top, extendRuns(mask, prevDiag, nextDiag + 1, n));
+        top = std::max(top, extendRuns(mask, prevAnti + 1, nextAnti, n));
+        if (top >= k)
+            return true;
 
-        if (!inBounds(ni, nj) || grid_[ni][nj] != symbol) {
-            return false;
+        if (rows) {
+            std::memcpy(window, mask, n);
+            int len = 1;
+            while (len * 2 <= k) {
+                andShifted(window, len, n);
+                len *= 2;
+            }
+            if (anyPair(window, k - len, n))
+                return true;
         }
     }
-    return true;
-}
\ No newline at end of file
+    return false;
+}
@@ -2,26 +2,87 @@
 #include <vector>
 #include <iostream>
 #include <stdexcept>
+#include <cstdint>
+
+class Board;
+
+class BoardListener {
+public:
+    virtual ~BoardListener() = default;
+    virtual void onPlace(const Board& board, int i, int j, char symbol) = 0;
+    virtual void onUnplace(const Board&, int, int) {}
+};
 
 class Board {
 public:
-    Board(int width = 3, int height = 3, char fill = '*');
+    Board(int width = 3, int height = 3, char fill = '*', int k = 3);
 
+    int width() const;
+    int height() const;
+    char at(int i, int j) const;
     bool inBounds(int i, int j) const;
     bool checkCellAccess(int i, int j) const;
     char place(int& whosMooveCounter, int i, int j);
+    void unplace(int& whosMooveCounter, int i, int j);
+    char makeMove(int& whosMooveCounter, int i, int j);
+    void unmakeMove(int& whosMooveCounter, int i, int j);
+    bool undo(int& whosMooveCounter);
+    bool redo(int& whosMooveCounter);
+    bool canUndo() const;
+    bool canRedo() const;
+    char state() const;
+    int movesMade() const;
     char checkWinCondition(int k = 3) const;
+    int winLength() const;
+    int filledCells() const;
+    uint64_t hash() const;
+    static uint64_t zobristKey(int cell, char player);
+    void setListener(BoardListener* listener);
+    BoardListener* listener() const;
 
-    std::vector<char>& operator[](int i);
-    const std::vector<char>& operator[](int i) const;
+    char* operator[](int i);
+    const char* operator[](int i) const;
 
     friend std::ostream& operator<<(std::ostream& os, const Board& _grid);
 
 private:
-    std::vector<std::vector<char>> grid_;
+    std::vector<char> cells_;
+    int width_;
+    int height_;
+    int stride_;
+    char fill_;
+    int k_;
+    int filled_;
+    uint64_t hash_;
+    BoardListener* listener_;
+
+    struct Move {
+        int cell;
+        char result;
+    };
+    std::vector<Move> history_;
+    std::vector<int> redo_;
+
     bool hasEmptyCells() const;
-    char checkCellForWin(int i, int j, int k) const;
-    bool checkDirection(int i, int j, int di, int dj, int k) const;
-    bool checkSequence(int i, int j, int di, int dj, int k, char symbol) const;
+    bool scanForWin(char symbol, int k) const;
+    bool checkLinesThrough(int i, int j, int k) const;
+    int countRun(int i, int j, int di, int dj, char symbol, int limit) const;
+};
+
+//                
+class ListenerPause {
+public:
+    explicit ListenerPause(Board& board) : board_(board), listener_(board.listener()) {
+        board_.setListener(nullptr);
+    }
+    ~ListenerPause() {
+        board_.setListener(listener_);
+    }
+    ListenerPause(const ListenerPause&) = delete;
+    ListenerPause& operator=(const ListenerPause&) = delete;
+
+private:
+    Board& board_;
+    BoardListener* listener_;
 };
 
@@ -1,8 +1,11 @@
 #include <gtest/gtest.h>
+#include <random>
 #include <sstream>
 #include <iostream>
 #include "Board.h"
 #include "../TttGame/TttGame.h"
+#include "../Engine/Engine.h"
+#include "../Dfpn/Dfpn.h"
 
 TEST(BoardTest, ConstructorValidSize) {
     EXPECT_NO_THROW(Board(3, 3));
@@ -125,7 +128,7 @@ TEST(BoardTest, SingleCellBoardDraw) {
     Board b(1, 1);
     int counter = 0;
     char result = b.place(counter, 0, 0); 
-    EXPECT_EQ(result, '*');
+    EXPECT_EQ(result, 'D');
     EXPECT_EQ(b.checkWinCondition(), 'D');
 }
 
@@ -206,7 +209,7 @@ TEST(BoardTest, SingleCellBoard) {
     Board b(1, 1);
     int counter = 0; 
     char result = b.place(counter, 0, 0);  
-    EXPECT_EQ(result, '*'); 
+    EXPECT_EQ(result, 'D'); 
     EXPECT_EQ(b.checkWinCondition(), 'D');
     EXPECT_FALSE(b.checkCellAccess(0, 0));
 }
@@ -269,7 +272,7 @@ TEST(BoardTest, CheckAllCellsOccupied) {
     b.place(counter, 1, 0); 
 
     char placeResult = b.place(counter, 1, 1); 
-    EXPECT_EQ(placeResult, '*'); 
+    EXPECT_EQ(placeResult, 'D'); 
 
     EXPECT_EQ(b.checkWinCondition(), 'D');
 }
@@ -332,11 +335,286 @@ TEST(BoardTest, SmallBoardDraw) {
     b.place(counter, 1, 0); 
     
     char placeResult = b.place(counter, 1, 1); 
-    EXPECT_EQ(placeResult, '*');
+    EXPECT_EQ(placeResult, 'D');
 
     EXPECT_EQ(b.checkWinCondition(), 'D');
 }
 
+TEST(BoardTest, WinLengthDefaultsToThree) {
+    Board b(5, 5);
+    EXPECT_EQ(b.winLength(), 3);
+    Board small(5, 5, '*', 2);
+    EXPECT_EQ(small.winLength(), 3);
+}
+
+TEST(BoardTest, PlaceHonoursConfiguredK) {
+    Board b(6, 6, '*', 4);
+    int counter = 0;
+    b.place(counter, 0, 0);
+    b.place(counter, 5, 5);
+    b.place(counter, 0, 1);
+    b.place(counter, 5, 4);
+    EXPECT_EQ(b.place(counter, 0, 2), '*');
+    b.place(counter, 5, 3);
+    EXPECT_EQ(b.place(counter, 0, 3), 'X');
+}
+
+TEST(BoardTest, PlaceDetectsWinThroughMiddleCell) {
+    Board b(7, 7, '*', 4);
+    int counter = 0;
+    b.place(counter, 1, 1);
+    b.place(counter, 0, 6);
+    b.place(counter, 2, 2);
+    b.place(counter, 1, 6);
+    b.place(counter, 4, 4);
+    b.place(counter, 2, 6);
+    EXPECT_EQ(b.place(counter, 3, 3), 'X');
+}
+
+TEST(BoardTest, PlaceWinOnLastCellIsNotDraw) {
+    Board b(3, 3);
+    int counter = 0;
+    int moves[8][2] = { {0, 0}, {0, 1}, {0, 2}, {1, 0}, {1, 1}, {1, 2}, {2, 1}, {2, 0} };
+    for (auto& m : moves)
+        EXPECT_EQ(b.place(counter, m[0], m[1]), '*');
+    EXPECT_EQ(b.place(counter, 2, 2), 'X');
+    EXPECT_EQ(b.filledCells(), 9);
+}
+
+TEST(BoardTest, PlaceReportsDrawWhenFull) {
+    Board b(3, 3);
+    int counter = 0;
+    int moves[9][2] = { {0, 0}, {0, 1}, {0, 2}, {1, 1}, {1, 0}, {1, 2}, {2, 1}, {2, 0}, {2, 2} };
+    char result = '*';
+    for (auto& m : moves)
+        result = b.place(counter, m[0], m[1]);
+    EXPECT_EQ(result, 'D');
+}
+
+TEST(BoardTest, PlaceReportsDrawOnBoardSmallerThanWinWindow) {
+    Board b(5, 1, '*', 4);
+    int counter = 0;
+    for (int j = 0; j < 4; ++j)
+        EXPECT_EQ(b.place(counter, 0, j), '*');
+    EXPECT_EQ(b.place(counter, 0, 4), 'D');
+    EXPECT_EQ(b.checkWinCondition(4), 'D');
+}
+
+TEST(BoardTest, HugeBoardIncrementalWin) {
+    Board b(100, 100, '*', 5);
+    int counter = 0;
+    for (int step = 0; step < 4; ++step) {
+        EXPECT_EQ(b.place(counter, 50, 40 + step), '*');
+        EXPECT_EQ(b.place(counter, 90, 10 + 2 * step), '*');
+    }
+    EXPECT_EQ(b.place(counter, 50, 44), 'X');
+}
+
+TEST(BoardTest, UnplaceRestoresCellAndCounter) {
+    Board b(3, 3);
+    int counter = 0;
+    b.place(counter, 1, 1);
+    b.place(counter, 0, 0);
+    b.unplace(counter, 0, 0);
+    EXPECT_EQ(counter, 1);
+    EXPECT_EQ(b[0][0], '*');
+    EXPECT_EQ(b.filledCells(), 1);
+    EXPECT_TRUE(b.checkCellAccess(0, 0));
+    EXPECT_EQ(b.place(counter, 0, 0), '*');
+    EXPECT_EQ(b[0][0], 'O');
+}
+
+TEST(BoardTest, UnplaceEmptyCellThrows) {
+    Board b(3, 3);
+    int counter = 0;
+    EXPECT_THROW(b.unplace(counter, 0, 0), std::logic_error);
+    EXPECT_THROW(b.unplace(counter, 5, 5), std::logic_error);
+}
+
+TEST(BoardTest, HashFollowsPlaceAndUnplace) {
+    Board b(3, 3);
+    int counter = 0;
+    EXPECT_EQ(b.hash(), 0u);
+    b.place(counter, 1, 1);
+    uint64_t afterOne = b.hash();
+    EXPECT_NE(afterOne, 0u);
+    b.place(counter, 0, 0);
+    b.unplace(counter, 0, 0);
+    EXPECT_EQ(b.hash(), afterOne);
+}
+
+TEST(BoardTest, HashIsSameForTranspositions) {
+    Board a(4, 4), b(4, 4);
+    int ca = 0, cb = 0;
+    a.place(ca, 0, 0); a.place(ca, 1, 1); a.place(ca, 2, 2); a.place(ca, 3, 3);
+    b.place(cb, 2, 2); b.place(cb, 3, 3); b.place(cb, 0, 0); b.place(cb, 1, 1);
+    EXPECT_EQ(a.hash(), b.hash());
+    EXPECT_NE(Board::zobristKey(5, 'X'), Board::zobristKey(5, 'O'));
+}
+
+TEST(BoardTest, FullScanFindsLinesAcrossRowChunks) {
+    const int dirs[4][2] = { {0, 1}, {1, 0}, {1, 1}, {1, -1} };
+    for (const auto& d : dirs) {
+        for (int k : { 3, 5, 17 }) {
+            Board b(40, 37);
+            int si = 10, sj = d[1] < 0 ? 30 : 8;
+            for (int s = 0; s < k; ++s)
+                b[si + s * d[0]][sj + s * d[1]] = 'O';
+            EXPECT_EQ(b.checkWinCondition(k), 'O');
+            b[si + (k / 2) * d[0]][sj + (k / 2) * d[1]] = 'X';
+            EXPECT_EQ(b.checkWinCondition(k), '*');
+        }
+    }
+}
+
+TEST(BoardTest, FullScanMatchesNaiveScan) {
+    std::mt19937 rng(7);
+    for (int round = 0; round < 200; ++round) {
+        int w = 1 + rng() % 35, h = 1 + rng() % 35, k = 3 + rng() % 4;
+        unsigned density = rng() % 10;
+        Board b(w, h);
+        for (int i = 0; i < h; ++i)
+            for (int j = 0; j < w; ++j) {
+                unsigned r = rng() % 10;
+                b[i][j] = r >= density ? '*' : r % 2 ? 'X' : 'O';
+            }
+        b[0][0] = '*';
+        bool x = false, o = false;
+        const int dirs[4][2] = { {0, 1}, {1, 0}, {1, 1}, {1, -1} };
+        for (int i = 0; i < h; ++i)
+            for (int j = 0; j < w; ++j)
+                for (const auto& d : dirs) {
+                    int s = 0;
+                    while (s < k && b.inBounds(i + s * d[0], j + s * d[1]) && b[i + s * d[0]][j + s * d[1]] == b[i][j])
+                        ++s;
+                    if (s == k && b[i][j] == 'X') x = true;
+                    if (s == k && b[i][j] == 'O') o = true;
+                }
+        char expected = x ? 'X' : o ? 'O' : '*';
+        EXPECT_EQ(b.checkWinCondition(k), expected) << w << 'x' << h << " k=" << k;
+    }
+}
+
+TEST(BoardTest, UndoRedoRestoresCounterAndState) {
+    Board b(3, 3);
+    int counter = 0;
+    int moves[5][2] = { {0, 0}, {1, 0}, {0, 1}, {1, 1}, {0, 2} };
+    for (auto& m : moves)
+        b.place(counter, m[0], m[1]);
+    uint64_t won = b.hash();
+    EXPECT_EQ(b.state(), 'X');
+    EXPECT_EQ(b.movesMade(), 5);
+
+    EXPECT_TRUE(b.undo(counter));
+    EXPECT_EQ(counter, 4);
+    EXPECT_EQ(b.state(), '*');
+    EXPECT_EQ(b[0][2], '*');
+    EXPECT_TRUE(b.undo(counter));
+    EXPECT_EQ(b[1][1], '*');
+    EXPECT_TRUE(b.canRedo());
+
+    EXPECT_TRUE(b.redo(counter));
+    EXPECT_TRUE(b.redo(counter));
+    EXPECT_FALSE(b.redo(counter));
+    EXPECT_EQ(counter, 5);
+    EXPECT_EQ(b.state(), 'X');
+    EXPECT_EQ(b.hash(), won);
+}
+
+TEST(BoardTest, NewMoveClearsRedo) {
+    Board b(3, 3);
+    int counter = 0;
+    b.place(counter, 0, 0);
+    b.place(counter, 1, 1);
+    b.undo(counter);
+    b.undo(counter);
+    EXPECT_FALSE(b.undo(counter));
+    EXPECT_EQ(counter, 0);
+
+    b.place(counter, 0, 0);
+    EXPECT_TRUE(b.canRedo());
+    b.place(counter, 2, 2);
+    EXPECT_FALSE(b.canRedo());
+    EXPECT_EQ(b.movesMade(), 2);
+}
+
+TEST(BoardTest, UnplaceKeepsHistoryInStep) {
+    Board b(4, 4);
+    int counter = 0;
+    b.place(counter, 0, 0);
+    b.place(counter, 1, 1);
+    b.place(counter, 2, 2);
+    b.unplace(counter, 2, 2);
+    EXPECT_EQ(b.movesMade(), 2);
+    EXPECT_TRUE(b.undo(counter));
+    EXPECT_EQ(b[1][1], '*');
+    EXPECT_EQ(b[0][0], 'X');
+}
+
+TEST(BoardTest, SearchKeepsUndoRedoStack) {
+    Board b(4, 4);
+    int counter = 0;
+    b.place(counter, 0, 0);
+    b.place(counter, 1, 1);
+    b.place(counter, 0, 1);
+    EXPECT_TRUE(b.undo(counter));
+    uint64_t before = b.hash();
+
+    Engine engine;
+    SearchLimits limits;
+    limits.maxDepth = 4;
+    engine.search(b, counter, limits);
+    Dfpn dfpn;
+    DfpnLimits dfpnLimits;
+    dfpnLimits.maxNodes = 2000;
+    dfpn.solve(b, counter, dfpnLimits);
+
+    EXPECT_EQ(counter, 2);
+    EXPECT_EQ(b.hash(), before);
+    EXPECT_EQ(b.movesMade(), 2);
+    EXPECT_TRUE(b.canRedo());
+    EXPECT_TRUE(b.redo(counter));
+    EXPECT_EQ(b[0][1], 'X');
+    EXPECT_EQ(b.movesMade(), 3);
+}
+
+TEST(BoardTest, ListenerPauseRestoresOnThrow) {
+    struct Counting : BoardListener {
+        int placed = 0;
+        void onPlace(const Board&, int, int, char) override { ++placed; }
+    } listener;
+
+    Board b(3, 3);
+    b.setListener(&listener);
+    int counter = 0;
+    try {
+        ListenerPause pause(b);
+        EXPECT_EQ(b.listener(), nullptr);
+        b.makeMove(counter, 0, 0);
+        b.makeMove(counter, 0, 0);
+    }
+    catch (const std::logic_error&) {
+    }
+    EXPECT_EQ(b.listener(), &listener);
+    EXPECT_EQ(listener.placed, 0);
+    b.place(counter, 1, 1);
+    EXPECT_EQ(listener.placed, 1);
+}
+
+TEST(BoardTest, MakeMoveSkipsHistory) {
+    Board b(3, 3);
+    int counter = 0;
+    b.place(counter, 1, 1);
+    b.undo(counter);
+    EXPECT_EQ(b.makeMove(counter, 0, 0), '*');
+    EXPECT_EQ(b.movesMade(), 0);
+    EXPECT_TRUE(b.canRedo());
+    b.unmakeMove(counter, 0, 0);
+    EXPECT_EQ(counter, 0);
+    EXPECT_EQ(b.hash(), 0u);
+    EXPECT_THROW(b.unmakeMove(counter, 0, 0), std::logic_error);
+}
+
 int main(int argc, char** argv) {
     testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
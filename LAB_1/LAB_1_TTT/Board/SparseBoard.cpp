@@ -0,0 +1,163 @@
+#include "SparseBoard.h"
+#include <algorithm>
+
+SparseBoard::SparseBoard(int k, char fill)
+    : tiles_(16, Tile{ 0, 0, 0, 0, false }), used_(0), fill_(fill), k_(k < 3 ? 3 : k), filled_(0),
+      minI_(0), minJ_(0), maxI_(-1), maxJ_(-1) {}
+
+int SparseBoard::bitIndex(long long i, long long j) {
+    return static_cast<int>(((i & (TILE - 1)) << TILE_BITS) | (j & (TILE - 1)));
+}
+
+size_t SparseBoard::mix(long long ti, long long tj) {
+    uint64_t key = static_cast<uint64_t>(ti) * 0x9E3779B97F4A7C15ULL ^ static_cast<uint64_t>(tj);
+    key = (key ^ (key >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    key = (key ^ (key >> 27)) * 0x94D049BB133111EBULL;
+    return static_cast<size_t>(key ^ (key >> 31));
+}
+
+const SparseBoard::Tile* SparseBoard::findTile(long long i, long long j) const {
+    long long ti = i >> TILE_BITS, tj = j >> TILE_BITS;
+    size_t mask = tiles_.size() - 1;
+    for (size_t slot = mix(ti, tj) & mask;; slot = (slot + 1) & mask) {
+        const Tile& tile = tiles_[slot];
+        if (!tile.used)
+            return nullptr;
+        if (tile.ti == ti && tile.tj == tj)
+            return &tile;
+    }
+}
+
+SparseBoard::Tile& SparseBoard::tileFor(long long i, long long j) {
+    if ((used_ + 1) * 2 > tiles_.size())
+        grow();
+    long long ti = i >> TILE_BITS, tj = j >> TILE_BITS;
+    size_t mask = tiles_.size() - 1;
+    for (size_t slot = mix(ti, tj) & mask;; slot = (slot + 1) & mask) {
+        Tile& tile = tiles_[slot];
+        if (tile.used && tile.ti == ti && tile.tj == tj)
+            return tile;
+        if (!tile.used) {
+            tile = Tile{ ti, tj, 0, 0, true };
+            ++used_;
+            return tile;
+        }
+    }
+}
+
+void SparseBoard::grow() {
+    std::vector<Tile> old(tiles_.size() * 2, Tile{ 0, 0, 0, 0, false });
+    old.swap(tiles_);
+    size_t mask = tiles_.size() - 1;
+    for (const Tile& tile : old) {
+        if (!tile.used)
+            continue;
+        size_t slot = mix(tile.ti, tile.tj) & mask;
+        while (tiles_[slot].used)
+            slot = (slot + 1) & mask;
+        tiles_[slot] = tile;
+    }
+}
+
+char SparseBoard::at(long long i, long long j) const {
+    const Tile* tile = findTile(i, j);
+    if (!tile)
+        return fill_;
+    uint64_t bit = 1ULL << bitIndex(i, j);
+    if (tile->x & bit)
+        return 'X';
+    if (tile->o & bit)
+        return 'O';
+    return fill_;
+}
+
+bool SparseBoard::checkCellAccess(long long i, long long j) const {
+    char c = at(i, j);
+    return !(c == 'O' || c == 'X');
+}
+
+int SparseBoard::countRun(long long i, long long j, int di, int dj, char symbol, int limit) const {
+    int run = 0;
+    for (int s = 1; s <= limit && at(i + di * s, j + dj * s) == symbol; ++s)
+        ++run;
+    return run;
+}
+
+char SparseBoard::place(int& whoseMoveCounter, long long i, long long j) {
+    if (!checkCellAccess(i, j)) throw std::logic_error("     ");
+
+    char symbol = (whoseMoveCounter % 2 == 0) ? 'X' : 'O';
+    Tile& tile = tileFor(i, j);
+    (symbol == 'X' ? tile.x : tile.o) |= 1ULL << bitIndex(i, j);
+    ++whoseMoveCounter;
+    if (filled_++ == 0) {
+        minI_ = maxI_ = i;
+        minJ_ = maxJ_ = j;
+    }
+    else {
+        minI_ = std::min(minI_, i);
+        maxI_ = std::max(maxI_, i);
+        minJ_ = std::min(minJ_, j);
+        maxJ_ = std::max(maxJ_, j);
+    }
+
+    static const int dirs[4][2] = { {0, 1}, {1, 0}, {1, 1}, {1, -1} };
+    for (auto& d : dirs) {
+        int run = 1 + countRun(i, j, d[0], d[1], symbol, k_ - 1);
+        run += countRun(i, j, -d[0], -d[1], symbol, k_ - run);
+        if (run >= k_)
+            return symbol;
+    }
+    return '*';
+}
+
+void SparseBoard::unplace(int& whoseMoveCounter, long long i, long long j) {
+    if (checkCellAccess(i, j)) throw std::logic_error("      ");
+
+    Tile& tile = tileFor(i, j);
+    uint64_t bit = 1ULL << bitIndex(i, j);
+    tile.x &= ~bit;
+    tile.o &= ~bit;
+    --whoseMoveCounter;
+    --filled_;
+}
+
+int SparseBoard::winLength() const {
+    return k_;
+}
+
+long long SparseBoard::filledCells() const {
+    return filled_;
+}
+
+size_t SparseBoard::tileCount() const {
+    return used_;
+}
+
+size_t SparseBoard::memoryUsage() const {
+    return sizeof(*this) + tiles_.capacity() * sizeof(Tile);
+}
+
+bool SparseBoard::bounds(long long& minI, long long& minJ, long long& maxI, long long& maxJ) const {
+    if (filled_ == 0)
+        return false;
+    minI = minI_;
+    minJ = minJ_;
+    maxI = maxI_;
+    maxJ = maxJ_;
+    return true;
+}
+
+std::ostream& operator<<(std::ostream& os, const SparseBoard& b) {
+    long long minI, minJ, maxI, maxJ;
+    if (!b.bounds(minI, minJ, maxI, maxJ))
+        return os;
+    for (long long i = minI; i <= maxI; ++i) {
+        for (long long j = minJ; j <= maxJ; ++j) {
+            os << b.at(i, j);
+            if (j < maxJ) os << ' ';
+        }
+        os << '\n';
+    }
+    return os;
+}
@@ -0,0 +1,49 @@
+#pragma once
+#include <vector>
+#include <iostream>
+#include <stdexcept>
+#include <cstdint>
+#include <cstddef>
+
+class SparseBoard {
+public:
+    static constexpr int TILE_BITS = 3;
+    static constexpr int TILE = 1 << TILE_BITS;
+
+    SparseBoard(int k = 5, char fill = '*');
+
+    char at(long long i, long long j) const;
+    bool checkCellAccess(long long i, long long j) const;
+    char place(int& whosMooveCounter, long long i, long long j);
+    void unplace(int& whosMooveCounter, long long i, long long j);
+    int winLength() const;
+    long long filledCells() const;
+    size_t tileCount() const;
+    size_t memoryUsage() const;
+    bool bounds(long long& minI, long long& minJ, long long& maxI, long long& maxJ) const;
+
+    friend std::ostream& operator<<(std::ostream& os, const SparseBoard& board);
+
+private:
+    struct Tile {
+        long long ti;
+        long long tj;
+        uint64_t x;
+        uint64_t o;
+        bool used;
+    };
+
+    std::vector<Tile> tiles_;
+    size_t used_;
+    char fill_;
+    int k_;
+    long long filled_;
+    long long minI_, minJ_, maxI_, maxJ_;
+
+    static int bitIndex(long long i, long long j);
+    static size_t mix(long long ti, long long tj);
+    const Tile* findTile(long long i, long long j) const;
+    Tile& tileFor(long long i, long long j);
+    void grow();
+    int countRun(long long i, long long j, int di, int dj, char symbol, int limit) const;
+};
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include "SparseBoard.h"
+
+TEST(SparseBoardTest, EmptyCellsReadAsFill) {
+    SparseBoard b;
+    EXPECT_EQ(b.at(0, 0), '*');
+    EXPECT_EQ(b.at(-1000000000LL, 5000000000LL), '*');
+    EXPECT_EQ(b.tileCount(), 0u);
+}
+
+TEST(SparseBoardTest, PlacesFarApartStones) {
+    SparseBoard b;
+    int counter = 0;
+    EXPECT_EQ(b.place(counter, 0, 0), '*');
+    EXPECT_EQ(b.place(counter, 3000000000LL, -3000000000LL), '*');
+    EXPECT_EQ(b.place(counter, -7, -7), '*');
+    EXPECT_EQ(b.at(0, 0), 'X');
+    EXPECT_EQ(b.at(3000000000LL, -3000000000LL), 'O');
+    EXPECT_EQ(b.at(-7, -7), 'X');
+    EXPECT_EQ(b.filledCells(), 3);
+    EXPECT_EQ(b.tileCount(), 3u);
+    EXPECT_THROW(b.place(counter, 0, 0), std::logic_error);
+}
+
+TEST(SparseBoardTest, DistantTilesDoNotAlias) {
+    SparseBoard b;
+    int counter = 0;
+    const long long far = 1LL << 35;
+    EXPECT_EQ(b.place(counter, 0, 0), '*');
+    EXPECT_EQ(b.at(far, 0), '*');
+    EXPECT_EQ(b.at(0, far), '*');
+    EXPECT_EQ(b.at(-far, far), '*');
+    EXPECT_EQ(b.place(counter, far, 0), '*');
+    EXPECT_EQ(b.place(counter, 0, far), '*');
+    EXPECT_EQ(b.at(far, 0), 'O');
+    EXPECT_EQ(b.at(0, far), 'X');
+    EXPECT_EQ(b.at(0, 0), 'X');
+    EXPECT_EQ(b.tileCount(), 3u);
+}
+
+TEST(SparseBoardTest, DetectsRunAcrossTilesAndZero) {
+    SparseBoard b(5);
+    int counter = 0;
+    long long xs[5] = { -2, -1, 0, 1, 2 };
+    char result = '*';
+    for (int n = 0; n < 5; ++n) {
+        result = b.place(counter, xs[n], 100 + xs[n]);
+        if (n < 4)
+            b.place(counter, 50, n);
+    }
+    EXPECT_EQ(result, 'X');
+}
+
+TEST(SparseBoardTest, DetectsHorizontalRunOverTileEdge) {
+    SparseBoard b(4);
+    int counter = 0;
+    b.place(counter, 3, 6);
+    b.place(counter, 0, 0);
+    b.place(counter, 3, 7);
+    b.place(counter, 0, 1);
+    b.place(counter, 3, 9);
+    b.place(counter, 0, 3);
+    EXPECT_EQ(b.place(counter, 3, 8), 'X');
+}
+
+TEST(SparseBoardTest, MemoryFollowsStonesNotArea) {
+    SparseBoard b(5);
+    int counter = 0;
+    for (long long n = 0; n < 1000; ++n)
+        b.place(counter, n * 1000003LL, -n * 999983LL);
+    EXPECT_EQ(b.tileCount(), 1000u);
+    EXPECT_LT(b.memoryUsage(), 200000u);
+    for (long long n = 0; n < 1000; ++n)
+        EXPECT_EQ(b.at(n * 1000003LL, -n * 999983LL), n % 2 == 0 ? 'X' : 'O');
+}
+
+TEST(SparseBoardTest, UnplaceAndPrint) {
+    SparseBoard b(3);
+    int counter = 0;
+    b.place(counter, 0, 0);
+    b.place(counter, 1, 2);
+    b.unplace(counter, 1, 2);
+    EXPECT_EQ(counter, 1);
+    EXPECT_EQ(b.at(1, 2), '*');
+    EXPECT_THROW(b.unplace(counter, 1, 2), std::logic_error);
+
+    b.place(counter, -1, 1);
+    std::stringstream ss;
+    ss << b;
+    EXPECT_EQ(ss.str(), "* O *\nX * *\n* * *\n");
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
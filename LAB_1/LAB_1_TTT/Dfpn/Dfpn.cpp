@@ -0,0 +1,262 @@
+#include "Dfpn.h"
+#include <algorithm>
+
+Dfpn::Dfpn() : capacity_(0), attacker_('X'), nodes_(0), gcRuns_(0), stopped_(false) {}
+
+const char* Dfpn::name(ProofResult result) {
+    switch (result) {
+    case ProofResult::Win: return "win";
+    case ProofResult::Draw: return "draw";
+    case ProofResult::Loss: return "loss";
+    default: return "unknown";
+    }
+}
+
+Dfpn::Node Dfpn::lookup(uint64_t key) const {
+    auto it = table_.find(key);
+    if (it == table_.end())
+        return Node{ 1, 1, 0 };
+    return it->second;
+}
+
+void Dfpn::store(uint64_t key, uint32_t pn, uint32_t dn, long long work) {
+    table_[key] = Node{ pn, dn, work };
+    if (table_.size() > capacity_)
+        collect();
+}
+
+//      :     
+void Dfpn::collect() {
+    std::vector<long long> works;
+    works.reserve(table_.size());
+    for (const auto& entry : table_)
+        works.push_back(entry.second.work);
+    auto middle = works.begin() + works.size() / 2;
+    std::nth_element(works.begin(), middle, works.end());
+    long long threshold = *middle;
+    for (auto it = table_.begin(); it != table_.end();) {
+        if (it->second.work <= threshold)
+            it = table_.erase(it);
+        else
+            ++it;
+    }
+    ++gcRuns_;
+}
+
+bool Dfpn::budgetExceeded() const {
+    if (limits_.maxNodes > 0 && nodes_ >= limits_.maxNodes)
+        return true;
+    if (limits_.maxMillis > 0 && (nodes_ & 1023) == 0) {
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start_).count();
+        return elapsed >= limits_.maxMillis;
+    }
+    return false;
+}
+
+bool Dfpn::expand(const Board& board, int counter, uint32_t& pn, uint32_t& dn, std::vector<int>& moves) const {
+    char mover = counter % 2 == 0 ? 'X' : 'O';
+    char previous = mover == 'X' ? 'O' : 'X';
+    int k = board.winLength();
+    moves.clear();
+
+    if (eval_.count(previous, k) > 0) {
+        pn = previous == attacker_ ? 0 : INF;
+        dn = previous == attacker_ ? INF : 0;
+        return true;
+    }
+    if (eval_.winningCells(mover) > 0) {
+        pn = mover == attacker_ ? 0 : INF;
+        dn = mover == attacker_ ? INF : 0;
+        return true;
+    }
+    bool attackerAlive = false;
+    for (int n = 0; n < k && !attackerAlive; ++n)
+        attackerAlive = eval_.count(attacker_, n) > 0;
+    if (!attackerAlive || board.filledCells() == board.width() * board.height()) {
+        pn = INF;
+        dn = 0;
+        return true;
+    }
+
+    int threats = eval_.winningCells(previous);
+    if (threats >= 2) {
+        pn = previous == attacker_ ? 0 : INF;
+        dn = previous == attacker_ ? INF : 0;
+        return true;
+    }
+    if (threats == 1) {
+        moves.push_back(eval_.findWinningCell(previous));
+        return false;
+    }
+
+    //   ,       ,        
+    for (int i = 0; i < board.height(); ++i)
+        for (int j = 0; j < board.width(); ++j)
+            if (board.checkCellAccess(i, j) && eval_.isLive(i, j))
+                moves.push_back(i * board.width() + j);
+    if (moves.empty()) {
+        pn = INF;
+        dn = 0;
+        return true;
+    }
+    return false;
+}
+
+void Dfpn::mid(Board& board, int& counter, uint32_t thpn, uint32_t thdn) {
+    ++nodes_;
+    long long startNodes = nodes_;
+    uint64_t key = board.hash();
+    uint32_t pn = 1, dn = 1;
+    std::vector<int> moves;
+    if (expand(board, counter, pn, dn, moves)) {
+        store(key, pn, dn, 0);
+        return;
+    }
+
+    char mover = counter % 2 == 0 ? 'X' : 'O';
+    bool orNode = mover == attacker_;
+    int width = board.width();
+    for (;;) {
+        uint64_t sum = 0;
+        uint32_t best = INF, second = INF;
+        int bestIndex = 0;
+        uint32_t bestPn = 1, bestDn = 1;
+        for (size_t m = 0; m < moves.size(); ++m) {
+            Node child = lookup(key ^ Board::zobristKey(moves[m], mover));
+            uint32_t selector = orNode ? child.pn : child.dn;
+            sum += orNode ? child.dn : child.pn;
+            if (selector < best) {
+                second = best;
+                best = selector;
+                bestIndex = static_cast<int>(m);
+                bestPn = child.pn;
+                bestDn = child.dn;
+            }
+            else if (selector < second)
+                second = selector;
+        }
+        uint32_t total = static_cast<uint32_t>(std::min<uint64_t>(sum, INF));
+        pn = orNode ? best : total;
+        dn = orNode ? total : best;
+        if (pn >= thpn || dn >= thdn || stopped_)
+            break;
+        if (budgetExceeded()) {
+            stopped_ = true;
+            break;
+        }
+
+        uint32_t childPn, childDn;
+        if (orNode) {
+            childPn = std::min<uint32_t>(thpn, second + 1);
+            childDn = static_cast<uint32_t>(std::min<uint64_t>(INF, static_cast<uint64_t>(thdn) - dn + bestDn));
+        }
+        else {
+            childPn = static_cast<uint32_t>(std::min<uint64_t>(INF, static_cast<uint64_t>(thpn) - pn + bestPn));
+            childDn = std::min<uint32_t>(thdn, second + 1);
+        }
+        int cell = moves[bestIndex];
+        board.makeMove(counter, cell / width, cell % width);
+        eval_.place(cell / width, cell % width, mover);
+        mid(board, counter, childPn, childDn);
+        eval_.unplace(cell / width, cell % width);
+        board.unmakeMove(counter, cell / width, cell % width);
+    }
+    store(key, pn, dn, nodes_ - startNodes + 1);
+}
+
+long long Dfpn::proofSize(Board& board, int& counter, std::unordered_set<uint64_t>& seen) {
+    uint64_t key = board.hash();
+    if (!seen.insert(key).second)
+        return 0;
+    uint32_t pn = 1, dn = 1;
+    std::vector<int> moves;
+    if (expand(board, counter, pn, dn, moves))
+        return 1;
+
+    Node node = lookup(key);
+    if (node.pn != 0 && node.dn != 0) {
+        mid(board, counter, INF, INF);
+        node = lookup(key);
+    }
+    char mover = counter % 2 == 0 ? 'X' : 'O';
+    bool orNode = mover == attacker_;
+    //         ,   -  ;
+    //   
+    bool needAll = (node.pn == 0) != orNode;
+    int width = board.width();
+    long long size = 1;
+    for (int cell : moves) {
+        Node child = lookup(key ^ Board::zobristKey(cell, mover));
+        bool solved = node.pn == 0 ? child.pn == 0 : child.dn == 0;
+        if (!needAll && !solved)
+            continue;
+        board.makeMove(counter, cell / width, cell % width);
+        eval_.place(cell / width, cell % width, mover);
+        size += proofSize(board, counter, seen);
+        eval_.unplace(cell / width, cell % width);
+        board.unmakeMove(counter, cell / width, cell % width);
+        if (!needAll)
+            break;
+    }
+    return size;
+}
+
+bool Dfpn::prove(Board& board, int counter, char attacker, int& row, int& col) {
+    table_.clear();
+    attacker_ = attacker;
+    eval_.reset(board);
+    mid(board, counter, INF, INF);
+    if (stopped_)
+        return false;
+
+    Node root = lookup(board.hash());
+    char mover = counter % 2 == 0 ? 'X' : 'O';
+    uint32_t pn = 1, dn = 1;
+    std::vector<int> moves;
+    expand(board, counter, pn, dn, moves);
+    for (int cell : moves) {
+        Node child = lookup(board.hash() ^ Board::zobristKey(cell, mover));
+        bool good = mover == attacker_ ? child.pn == 0 : child.dn == 0;
+        if (good || row < 0) {
+            row = cell / board.width();
+            col = cell % board.width();
+            if (good)
+                break;
+        }
+    }
+    return root.pn == 0;
+}
+
+DfpnResult Dfpn::solve(Board& board, int whoseMoveCounter, const DfpnLimits& limits) {
+    ListenerPause pause(board);
+    limits_ = limits;
+    capacity_ = std::max<size_t>(64, limits.megabytes * 1024 * 1024 / 64);
+    start_ = std::chrono::steady_clock::now();
+    nodes_ = 0;
+    gcRuns_ = 0;
+    stopped_ = false;
+
+    DfpnResult result;
+    char mover = whoseMoveCounter % 2 == 0 ? 'X' : 'O';
+    char opponent = mover == 'X' ? 'O' : 'X';
+    int counter = whoseMoveCounter;
+    if (prove(board, counter, mover, result.row, result.col))
+        result.result = ProofResult::Win;
+    else if (!stopped_) {
+        result.row = result.col = -1;
+        result.result = prove(board, counter, opponent, result.row, result.col) ? ProofResult::Loss : ProofResult::Draw;
+    }
+    if (stopped_) {
+        result.result = ProofResult::Unknown;
+        result.row = result.col = -1;
+    }
+    else {
+        std::unordered_set<uint64_t> seen;
+        result.proofSize = proofSize(board, counter, seen);
+    }
+    result.nodes = nodes_;
+    result.tableEntries = table_.size();
+    result.gcRuns = gcRuns_;
+    result.millis = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start_).count();
+    return result;
+}
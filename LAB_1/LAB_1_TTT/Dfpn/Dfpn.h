@@ -0,0 +1,65 @@
+#pragma once
+#include <vector>
+#include <chrono>
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+#include "../Board/Board.h"
+#include "../Evaluator/Evaluator.h"
+
+enum class ProofResult { Unknown, Win, Draw, Loss };
+
+struct DfpnLimits {
+    size_t megabytes = 64;
+    long long maxNodes = 0;
+    int maxMillis = 0;
+};
+
+struct DfpnResult {
+    ProofResult result = ProofResult::Unknown;
+    int row = -1;
+    int col = -1;
+    long long nodes = 0;
+    long long proofSize = 0;
+    size_t tableEntries = 0;
+    int gcRuns = 0;
+    double millis = 0.0;
+};
+
+class Dfpn {
+public:
+    static constexpr uint32_t INF = 0x3FFFFFFF;
+
+    Dfpn();
+    Dfpn(const Dfpn&) = delete;
+    Dfpn& operator=(const Dfpn&) = delete;
+
+    DfpnResult solve(Board& board, int whoseMoveCounter, const DfpnLimits& limits);
+    static const char* name(ProofResult result);
+
+private:
+    struct Node {
+        uint32_t pn;
+        uint32_t dn;
+        long long work;
+    };
+
+    std::unordered_map<uint64_t, Node> table_;
+    size_t capacity_;
+    Evaluator eval_;
+    char attacker_;
+    long long nodes_;
+    int gcRuns_;
+    bool stopped_;
+    DfpnLimits limits_;
+    std::chrono::steady_clock::time_point start_;
+
+    bool prove(Board& board, int counter, char attacker, int& row, int& col);
+    void mid(Board& board, int& counter, uint32_t thpn, uint32_t thdn);
+    bool expand(const Board& board, int counter, uint32_t& pn, uint32_t& dn, std::vector<int>& moves) const;
+    Node lookup(uint64_t key) const;
+    void store(uint64_t key, uint32_t pn, uint32_t dn, long long work);
+    void collect();
+    bool budgetExceeded() const;
+    long long proofSize(Board& board, int& counter, std::unordered_set<uint64_t>& seen);
+};
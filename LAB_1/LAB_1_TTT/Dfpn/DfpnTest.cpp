@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <random>
+#include "Dfpn.h"
+#include "../Tablebase/Tablebase.h"
+
+static ProofResult fromTablebase(TbResult r) {
+    return r == TbResult::Win ? ProofResult::Win : r == TbResult::Loss ? ProofResult::Loss : ProofResult::Draw;
+}
+
+TEST(DfpnTest, EmptyThreeByThreeIsDraw) {
+    Dfpn solver;
+    Board b(3, 3);
+    DfpnResult r = solver.solve(b, 0, DfpnLimits());
+    EXPECT_EQ(r.result, ProofResult::Draw);
+    EXPECT_GT(r.proofSize, 1);
+    EXPECT_GT(r.nodes, 0);
+    EXPECT_TRUE(b.checkCellAccess(r.row, r.col));
+    EXPECT_EQ(b.filledCells(), 0);
+}
+
+TEST(DfpnTest, FourByFourKThreeIsFirstPlayerWin) {
+    Dfpn solver;
+    Board b(4, 4);
+    DfpnResult r = solver.solve(b, 0, DfpnLimits());
+    EXPECT_EQ(r.result, ProofResult::Win);
+    ASSERT_TRUE(b.checkCellAccess(r.row, r.col));
+
+    int counter = 0;
+    b.place(counter, r.row, r.col);
+    EXPECT_EQ(solver.solve(b, counter, DfpnLimits()).result, ProofResult::Loss);
+}
+
+TEST(DfpnTest, MatchesTablebaseOnRandomPositions) {
+    const char* path = "dfpn_tb.ttb";
+    Tablebase::generate(4, 3, 3, path);
+    Tablebase tb;
+    tb.open(path);
+    Dfpn solver;
+    std::mt19937 rng(3);
+    for (int game = 0; game < 60; ++game) {
+        Board b(4, 3);
+        int counter = 0;
+        int plies = static_cast<int>(rng() % 6);
+        char state = '*';
+        for (int p = 0; p < plies && state == '*'; ++p) {
+            int i, j;
+            do {
+                i = static_cast<int>(rng() % 3);
+                j = static_cast<int>(rng() % 4);
+            } while (!b.checkCellAccess(i, j));
+            state = b.place(counter, i, j);
+        }
+        if (state != '*')
+            continue;
+        DfpnResult r = solver.solve(b, counter, DfpnLimits());
+        EXPECT_EQ(r.result, fromTablebase(tb.probe(b).result));
+    }
+    std::remove(path);
+}
+
+TEST(DfpnTest, MemoryCapTriggersCollection) {
+    Dfpn solver;
+    Board b(4, 4);
+    DfpnLimits limits;
+    limits.megabytes = 0;
+    DfpnResult r = solver.solve(b, 0, limits);
+    EXPECT_EQ(r.result, ProofResult::Win);
+    EXPECT_GT(r.gcRuns, 0);
+    EXPECT_LE(r.tableEntries, 64u);
+    EXPECT_GT(r.proofSize, 1);
+}
+
+TEST(DfpnTest, NodeBudgetGivesUnknown) {
+    Dfpn solver;
+    Board b(7, 7, '*', 5);
+    DfpnLimits limits;
+    limits.maxNodes = 200;
+    DfpnResult r = solver.solve(b, 0, limits);
+    EXPECT_EQ(r.result, ProofResult::Unknown);
+    EXPECT_LE(r.nodes, 200);
+    EXPECT_EQ(b.filledCells(), 0);
+}
+
+TEST(DfpnTest, FindsForcedWinOnLargeBoard) {
+    Dfpn solver;
+    Board b(7, 7, '*', 5);
+    int counter = 0;
+    int moves[6][2] = { {3, 1}, {0, 0}, {3, 2}, {0, 6}, {3, 3}, {6, 0} };
+    for (auto& m : moves)
+        b.place(counter, m[0], m[1]);
+    DfpnResult r = solver.solve(b, counter, DfpnLimits());
+    ASSERT_EQ(r.result, ProofResult::Win);
+    b.place(counter, r.row, r.col);
+    EXPECT_EQ(solver.solve(b, counter, DfpnLimits()).result, ProofResult::Loss);
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,454 @@
+#include "Engine.h"
+#include <algorithm>
+#include <cstdlib>
+#include <thread>
+#include "../OpeningBook/OpeningBook.h"
+
+Engine::Engine(size_t ttMegabytes) : Engine(nullptr, nullptr, ttMegabytes) {}
+
+Engine::Engine(TranspositionTable* shared, std::atomic<bool>* stop, size_t ttMegabytes)
+    : ownTable_(shared ? nullptr : new TranspositionTable(ttMegabytes)), tt_(shared ? shared : ownTable_.get()),
+      ttMegabytes_(ttMegabytes), ttShape_(-1), book_(nullptr), width_(0), height_(0), symmetric_(false), rootMoves_(nullptr), nodes_(0), stopped_(false),
+      stopFlag_(false), stop_(stop ? stop : &stopFlag_) {}
+
+const TranspositionTable& Engine::table() const {
+    return *tt_;
+}
+
+void Engine::clearTable() {
+    tt_->clear();
+    ttShape_ = -1;
+}
+
+void Engine::setBook(const OpeningBook* book) {
+    book_ = book;
+}
+
+uint64_t Engine::tableKey(const Board& board, int& symmetry) const {
+    symmetry = 0;
+    if (!symmetric_)
+        return board.hash();
+    return Symmetry::canonicalHash(board, &symmetry);
+}
+
+int Engine::toTableMove(int move, int symmetry) const {
+    if (move < 0 || symmetry == 0)
+        return move;
+    int i = move / width_, j = move % width_;
+    Symmetry::mapCell(symmetry, width_, height_, i, j);
+    return i * width_ + j;
+}
+
+int Engine::fromTableMove(int move, int symmetry) const {
+    if (move < 0 || symmetry == 0)
+        return move;
+    int i = move / width_, j = move % width_;
+    Symmetry::unmapCell(symmetry, width_, height_, i, j);
+    return i * width_ + j;
+}
+
+int Engine::scoreToTable(int score, int ply) {
+    if (isWinScore(score))
+        return score > 0 ? score + ply : score - ply;
+    return score;
+}
+
+int Engine::scoreFromTable(int score, int ply) {
+    if (isWinScore(score))
+        return score > 0 ? score - ply : score + ply;
+    return score;
+}
+
+bool Engine::isWinScore(int score) {
+    return std::abs(score) > WIN_SCORE - 10000;
+}
+
+void Engine::reset(const Board& board) {
+    int cells = board.width() * board.height();
+    int maxPly = cells + 2;
+    width_ = board.width();
+    height_ = board.height();
+    symmetric_ = Symmetry::supports(width_, height_);
+    pv_.assign(maxPly, std::vector<int>(maxPly, -1));
+    pvLength_.assign(maxPly, 0);
+    previousPv_.assign(maxPly, -1);
+    killers_.assign(maxPly, { -1, -1 });
+    history_.assign(cells, 0);
+    near_.assign(cells, 0);
+    //      ,     
+    if (static_cast<int>(moves_.size()) < maxPly) {
+        moves_.resize(maxPly);
+        scored_.resize(maxPly);
+    }
+    eval_.reset(board);
+    nodes_ = 0;
+    ttStats_ = TtStats();
+    stopped_ = false;
+}
+
+bool Engine::budgetExceeded() const {
+    if (limits_.maxNodes > 0 && nodes_ >= limits_.maxNodes)
+        return true;
+    if (limits_.maxMillis > 0) {
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start_);
+        if (elapsed.count() >= limits_.maxMillis)
+            return true;
+    }
+    return false;
+}
+
+void Engine::generateMoves(const Board& board, std::vector<int>& moves) {
+    int w = board.width();
+    int h = board.height();
+    moves.clear();
+
+    if (w * h <= 64 || board.filledCells() == 0) {
+        for (int i = 0; i < h; ++i)
+            for (int j = 0; j < w; ++j)
+                if (board.checkCellAccess(i, j))
+                    moves.push_back(i * w + j);
+        if (board.filledCells() == 0 && w * h > 64) {
+            moves.clear();
+            moves.push_back((h / 2) * w + w / 2);
+        }
+        return;
+    }
+
+    std::fill(near_.begin(), near_.end(), 0);
+    for (int i = 0; i < h; ++i)
+        for (int j = 0; j < w; ++j) {
+            if (board.checkCellAccess(i, j))
+                continue;
+            for (int di = -2; di <= 2; ++di)
+                for (int dj = -2; dj <= 2; ++dj)
+                    if (board.inBounds(i + di, j + dj))
+                        near_[(i + di) * w + (j + dj)] = 1;
+        }
+    for (int i = 0; i < h; ++i)
+        for (int j = 0; j < w; ++j)
+            if (near_[i * w + j] && board.checkCellAccess(i, j))
+                moves.push_back(i * w + j);
+}
+
+void Engine::orderMoves(const Board& board, std::vector<int>& moves, int ply, int ttMove) {
+    int w = board.width();
+    int h = board.height();
+    std::vector<std::pair<long long, int>>& scored = scored_[ply];
+    scored.clear();
+    for (int m : moves) {
+        long long score = history_[m];
+        if (m == ttMove)
+            score += 8000000000LL;
+        else if (m == previousPv_[ply])
+            score += 4000000000LL;
+        else if (m == killers_[ply][0])
+            score += 2000000000LL;
+        else if (m == killers_[ply][1])
+            score += 1000000000LL;
+        int ci = m / w, cj = m % w;
+        score = score * 64 - (std::abs(2 * ci - (h - 1)) + std::abs(2 * cj - (w - 1)));
+        scored.emplace_back(score, m);
+    }
+    std::stable_sort(scored.begin(), scored.end(),
+        [](const std::pair<long long, int>& a, const std::pair<long long, int>& b) { return a.first > b.first; });
+    for (size_t n = 0; n < moves.size(); ++n)
+        moves[n] = scored[n].second;
+}
+
+int Engine::negamax(Board& board, int& counter, int depth, int ply, int alpha, int beta) {
+    pvLength_[ply] = ply;
+    if ((++nodes_ & 1023) == 0 && (budgetExceeded() || stop_->load(std::memory_order_relaxed)))
+        stopped_ = true;
+    if (stopped_)
+        return 0;
+
+    //     ,      
+    if (depth == 0)
+        return eval_.evaluate(counter % 2 == 0 ? 'X' : 'O');
+
+    std::vector<int>& moves = moves_[ply];
+    if (ply == 0 && rootMoves_)
+        moves = *rootMoves_;
+    else
+        generateMoves(board, moves);
+    if (moves.empty())
+        return 0;
+
+    int alphaOrig = alpha;
+    TtEntry entry;
+    int ttMove = -1;
+    int symmetry = 0;
+    uint64_t key = tableKey(board, symmetry);
+    if (tt_->probe(key, entry, &ttStats_)) {
+        ttMove = fromTableMove(entry.move, symmetry);
+        if (ply > 0 && entry.depth >= depth) {
+            int ttScore = scoreFromTable(entry.score, ply);
+            if ((entry.bound != Bound::Upper && ttScore >= beta) || (entry.bound != Bound::Lower && ttScore <= alpha))
+                return ttScore;
+        }
+    }
+    orderMoves(board, moves, ply, ttMove);
+
+    int best = -INF_SCORE;
+    int bestMove = moves[0];
+    for (int m : moves) {
+        int i = m / width_, j = m % width_;
+        char symbol = counter % 2 == 0 ? 'X' : 'O';
+        char result = board.makeMove(counter, i, j);
+        int score;
+        if (result == 'X' || result == 'O') {
+            score = WIN_SCORE - (ply + 1);
+            pvLength_[ply + 1] = ply + 1;
+        }
+        else if (result == 'D') {
+            score = 0;
+            pvLength_[ply + 1] = ply + 1;
+        }
+        else {
+            eval_.place(i, j, symbol);
+            score = -negamax(board, counter, depth - 1, ply + 1, -beta, -alpha);
+            eval_.unplace(i, j);
+        }
+        board.unmakeMove(counter, i, j);
+        if (stopped_)
+            return 0;
+
+        if (score > best) {
+            best = score;
+            bestMove = m;
+        }
+        if (score > alpha) {
+            alpha = score;
+            pv_[ply][ply] = m;
+            for (int n = ply + 1; n < pvLength_[ply + 1]; ++n)
+                pv_[ply][n] = pv_[ply + 1][n];
+            pvLength_[ply] = std::max(pvLength_[ply + 1], ply + 1);
+        }
+        if (alpha >= beta) {
+            if (killers_[ply][0] != m) {
+                killers_[ply][1] = killers_[ply][0];
+                killers_[ply][0] = m;
+            }
+            history_[m] += depth * depth;
+            break;
+        }
+    }
+
+    Bound bound = best <= alphaOrig ? Bound::Upper : (best >= beta ? Bound::Lower : Bound::Exact);
+    tt_->store(key, depth, bound, scoreToTable(best, ply), toTableMove(bestMove, symmetry));
+    return best;
+}
+
+void Engine::collectPv(SearchResult& result, int depth, int score) {
+    result.depth = depth;
+    result.score = score;
+    result.pv.clear();
+    for (int n = 0; n < pvLength_[0]; ++n) {
+        result.pv.emplace_back(pv_[0][n] / width_, pv_[0][n] % width_);
+        previousPv_[n] = pv_[0][n];
+    }
+    if (!result.pv.empty()) {
+        result.row = result.pv[0].first;
+        result.col = result.pv[0].second;
+    }
+}
+
+SearchResult Engine::iterate(Board& board, int whoseMoveCounter, int firstDepth) {
+    reset(board);
+
+    SearchResult result;
+    std::vector<int> rootMoves;
+    generateMoves(board, rootMoves);
+    if (rootMoves.empty())
+        return result;
+    orderMoves(board, rootMoves, 0, -1);
+    result.row = rootMoves[0] / width_;
+    result.col = rootMoves[0] % width_;
+
+    int empties = board.width() * board.height() - board.filledCells();
+    int maxDepth = std::min(limits_.maxDepth, empties);
+    int counter = whoseMoveCounter;
+    for (int depth = firstDepth; depth <= maxDepth; ++depth) {
+        int score = negamax(board, counter, depth, 0, -INF_SCORE, INF_SCORE);
+        if (stopped_)
+            break;
+        collectPv(result, depth, score);
+        if (isWinScore(score))
+            break;
+    }
+    result.nodes = nodes_;
+    return result;
+}
+
+void Engine::prepareHelpers(int count, bool privateTables) {
+    bool reusable = static_cast<int>(helpers_.size()) == count
+        && (helpers_.empty() || (helpers_[0]->ownTable_ != nullptr) == privateTables);
+    if (reusable)
+        return;
+    helpers_.clear();
+    size_t megabytes = std::max<size_t>(1, ttMegabytes_ / std::max(1, count));
+    for (int n = 0; n < count; ++n)
+        helpers_.emplace_back(new Engine(privateTables ? nullptr : tt_, &stopFlag_, megabytes));
+}
+
+SearchResult Engine::searchLazySmp(Board& board, int whoseMoveCounter) {
+    prepareHelpers(limits_.threads - 1, false);
+
+    std::vector<Board> boards(helpers_.size(), board);
+    std::vector<std::thread> workers;
+    for (size_t n = 0; n < helpers_.size(); ++n) {
+        Engine& helper = *helpers_[n];
+        helper.limits_ = limits_;
+        helper.limits_.maxNodes = 0;
+        helper.limits_.maxMillis = 0;
+        helper.start_ = start_;
+        workers.emplace_back([&helper, &boards, n, whoseMoveCounter] {
+            helper.iterate(boards[n], whoseMoveCounter, 1 + (n + 1) % 2);
+        });
+    }
+
+    SearchResult result = iterate(board, whoseMoveCounter, 1);
+    stopFlag_ = true;
+    for (auto& w : workers)
+        w.join();
+    for (auto& helper : helpers_)
+        result.nodes += helper->nodes_;
+    return result;
+}
+
+SearchResult Engine::searchSplit(Board& board, int whoseMoveCounter) {
+    int threads = limits_.threads;
+    prepareHelpers(threads, true);
+    reset(board);
+
+    SearchResult result;
+    std::vector<int> rootMoves;
+    generateMoves(board, rootMoves);
+    if (rootMoves.empty())
+        return result;
+    orderMoves(board, rootMoves, 0, -1);
+    result.row = rootMoves[0] / width_;
+    result.col = rootMoves[0] % width_;
+
+    std::vector<Board> boards(threads, board);
+    std::vector<std::vector<int>> subsets(threads);
+    for (auto& helper : helpers_) {
+        helper->tt_->clear();
+        helper->reset(board);
+        helper->limits_ = limits_;
+        if (limits_.maxNodes > 0)
+            helper->limits_.maxNodes = std::max(1LL, limits_.maxNodes / threads);
+        helper->start_ = start_;
+    }
+
+    int empties = board.width() * board.height() - board.filledCells();
+    int maxDepth = std::min(limits_.maxDepth, empties);
+    for (int depth = 1; depth <= maxDepth; ++depth) {
+        for (auto& subset : subsets)
+            subset.clear();
+        for (size_t n = 0; n < rootMoves.size(); ++n)
+            subsets[n % threads].push_back(rootMoves[n]);
+
+        std::vector<int> scores(threads, -INF_SCORE);
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; ++t) {
+            if (subsets[t].empty())
+                continue;
+            workers.emplace_back([this, &boards, &subsets, &scores, t, depth, whoseMoveCounter] {
+                Engine& helper = *helpers_[t];
+                int counter = whoseMoveCounter;
+                helper.rootMoves_ = &subsets[t];
+                scores[t] = helper.negamax(boards[t], counter, depth, 0, -INF_SCORE, INF_SCORE);
+                helper.rootMoves_ = nullptr;
+            });
+        }
+        for (auto& w : workers)
+            w.join();
+
+        bool stopped = false;
+        for (auto& helper : helpers_)
+            stopped = stopped || helper->stopped_;
+        if (stopped)
+            break;
+
+        int best = -1;
+        size_t bestIndex = rootMoves.size();
+        for (int t = 0; t < threads; ++t) {
+            if (subsets[t].empty())
+                continue;
+            const Engine& helper = *helpers_[t];
+            size_t index = std::find(rootMoves.begin(), rootMoves.end(), helper.pv_[0][0]) - rootMoves.begin();
+            if (best < 0 || scores[t] > scores[best] || (scores[t] == scores[best] && index < bestIndex)) {
+                best = t;
+                bestIndex = index;
+            }
+        }
+        helpers_[best]->collectPv(result, depth, scores[best]);
+        std::rotate(rootMoves.begin(), rootMoves.begin() + bestIndex, rootMoves.begin() + bestIndex + 1);
+        if (isWinScore(scores[best]))
+            break;
+    }
+
+    for (auto& helper : helpers_)
+        result.nodes += helper->nodes_;
+    return result;
+}
+
+bool Engine::threatWin(const Board& board, int whoseMoveCounter, SearchResult& result) const {
+    if (board.width() * board.height() <= 64)
+        return false;
+    Evaluator evaluator(board);
+    std::vector<std::pair<int, int>> line;
+    if (!evaluator.threatSpaceSearch(whoseMoveCounter % 2 == 0 ? 'X' : 'O', 6, line))
+        return false;
+    result.row = line[0].first;
+    result.col = line[0].second;
+    result.depth = static_cast<int>(line.size());
+    result.score = WIN_SCORE - result.depth;
+    result.pv = line;
+    return true;
+}
+
+SearchResult Engine::search(Board& board, int whoseMoveCounter, const SearchLimits& limits) {
+    ListenerPause pause(board);
+
+    long long shape = (static_cast<long long>(board.width()) * 4096 + board.height()) * 4096 + board.winLength();
+    if (shape != ttShape_)
+        tt_->clear();
+    ttShape_ = shape;
+    tt_->newSearch();
+
+    limits_ = limits;
+    limits_.threads = std::max(1, limits.threads);
+    start_ = std::chrono::steady_clock::now();
+    stopFlag_ = false;
+    ttStats_ = TtStats();
+    for (auto& helper : helpers_)
+        helper->ttStats_ = TtStats();
+
+    SearchResult result;
+    if (book_ && book_->probe(board, result.row, result.col, &result.score))
+        result.pv.push_back({ result.row, result.col });
+    else if (!threatWin(board, whoseMoveCounter, result)) {
+        if (limits_.threads == 1)
+            result = iterate(board, whoseMoveCounter, 1);
+        else if (limits_.deterministic)
+            result = searchSplit(board, whoseMoveCounter);
+        else
+            result = searchLazySmp(board, whoseMoveCounter);
+    }
+    result.threads = limits_.threads;
+
+    TtStats stats = ttStats_;
+    if (limits_.threads > 1)
+        for (auto& helper : helpers_)
+            stats += helper->ttStats_;
+    result.ttProbes = stats.probes;
+    result.ttHits = stats.hits;
+    result.ttHitRate = stats.hitRate();
+
+    result.millis = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start_).count();
+    if (result.millis > 0)
+        result.nodesPerSecond = result.nodes * 1000.0 / result.millis;
+    return result;
+}
@@ -0,0 +1,100 @@
+#pragma once
+#include <vector>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <utility>
+#include "../Board/Board.h"
+#include "../TranspositionTable/TranspositionTable.h"
+#include "../Evaluator/Evaluator.h"
+#include "../Symmetry/Symmetry.h"
+
+class OpeningBook;
+
+struct SearchLimits {
+    int maxDepth = 64;
+    long long maxNodes = 0;
+    int maxMillis = 0;
+    int threads = 1;
+    bool deterministic = false;
+};
+
+struct SearchResult {
+    int row = -1;
+    int col = -1;
+    int score = 0;
+    int depth = 0;
+    long long nodes = 0;
+    double ttHitRate = 0.0;
+    uint64_t ttProbes = 0;
+    uint64_t ttHits = 0;
+    double millis = 0.0;
+    double nodesPerSecond = 0.0;
+    int threads = 1;
+    std::vector<std::pair<int, int>> pv;
+};
+
+class Engine {
+public:
+    static constexpr int WIN_SCORE = 1000000;
+    static constexpr int INF_SCORE = WIN_SCORE + 1;
+
+    explicit Engine(size_t ttMegabytes = 16);
+    Engine(const Engine&) = delete;
+    Engine& operator=(const Engine&) = delete;
+
+    SearchResult search(Board& board, int whoseMoveCounter, const SearchLimits& limits);
+    const TranspositionTable& table() const;
+    void clearTable();
+    void setBook(const OpeningBook* book);
+    static bool isWinScore(int score);
+
+private:
+    std::unique_ptr<TranspositionTable> ownTable_;
+    TranspositionTable* tt_;
+    size_t ttMegabytes_;
+    long long ttShape_;
+    std::vector<std::unique_ptr<Engine>> helpers_;
+    const OpeningBook* book_;
+
+    int width_;
+    int height_;
+    bool symmetric_;
+    std::vector<std::vector<int>> pv_;
+    std::vector<int> pvLength_;
+    std::vector<int> previousPv_;
+    std::vector<std::array<int, 2>> killers_;
+    std::vector<int> history_;
+    std::vector<char> near_;
+    std::vector<std::vector<int>> moves_;
+    std::vector<std::vector<std::pair<long long, int>>> scored_;
+    Evaluator eval_;
+    const std::vector<int>* rootMoves_;
+    long long nodes_;
+    TtStats ttStats_;
+    bool stopped_;
+    std::atomic<bool> stopFlag_;
+    std::atomic<bool>* stop_;
+    SearchLimits limits_;
+    std::chrono::steady_clock::time_point start_;
+
+    Engine(TranspositionTable* shared, std::atomic<bool>* stop, size_t ttMegabytes);
+
+    int negamax(Board& board, int& counter, int depth, int ply, int alpha, int beta);
+    void generateMoves(const Board& board, std::vector<int>& moves);
+    void orderMoves(const Board& board, std::vector<int>& moves, int ply, int ttMove);
+    bool budgetExceeded() const;
+    void reset(const Board& board);
+    void collectPv(SearchResult& result, int depth, int score);
+    bool threatWin(const Board& board, int whoseMoveCounter, SearchResult& result) const;
+    SearchResult iterate(Board& board, int whoseMoveCounter, int firstDepth);
+    SearchResult searchLazySmp(Board& board, int whoseMoveCounter);
+    SearchResult searchSplit(Board& board, int whoseMoveCounter);
+    void prepareHelpers(int count, bool privateTables);
+    uint64_t tableKey(const Board& board, int& symmetry) const;
+    int toTableMove(int move, int symmetry) const;
+    int fromTableMove(int move, int symmetry) const;
+    static int scoreToTable(int score, int ply);
+    static int scoreFromTable(int score, int ply);
+};
@@ -0,0 +1,166 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include "Engine.h"
+
+static std::string render(const Board& b) {
+    std::stringstream ss;
+    ss << b;
+    return ss.str();
+}
+
+TEST(EngineTest, TakesImmediateWin) {
+    Board b(3, 3);
+    int counter = 0;
+    b.place(counter, 0, 0);
+    b.place(counter, 1, 0);
+    b.place(counter, 0, 1);
+    b.place(counter, 1, 1);
+
+    Engine engine;
+    SearchResult r = engine.search(b, counter, SearchLimits());
+    EXPECT_EQ(r.row, 0);
+    EXPECT_EQ(r.col, 2);
+    EXPECT_TRUE(Engine::isWinScore(r.score));
+    EXPECT_GT(r.score, 0);
+}
+
+TEST(EngineTest, BlocksOpponentWin) {
+    Board b(3, 3);
+    int counter = 0;
+    b.place(counter, 0, 0);
+    b.place(counter, 1, 1);
+    b.place(counter, 0, 1);
+
+    Engine engine;
+    SearchResult r = engine.search(b, counter, SearchLimits());
+    EXPECT_EQ(r.row, 0);
+    EXPECT_EQ(r.col, 2);
+}
+
+TEST(EngineTest, EmptyThreeByThreeIsDraw) {
+    Board b(3, 3);
+    Engine engine;
+    SearchResult r = engine.search(b, 0, SearchLimits());
+    EXPECT_EQ(r.score, 0);
+    EXPECT_EQ(r.depth, 9);
+    EXPECT_EQ(r.pv.size(), 9u);
+    EXPECT_TRUE(b.checkCellAccess(r.row, r.col));
+}
+
+TEST(EngineTest, SearchRestoresBoard) {
+    Board b(4, 4);
+    int counter = 0;
+    b.place(counter, 1, 1);
+    b.place(counter, 2, 2);
+    std::string before = render(b);
+
+    Engine engine;
+    SearchLimits limits;
+    limits.maxDepth = 5;
+    engine.search(b, counter, limits);
+    EXPECT_EQ(render(b), before);
+    EXPECT_EQ(b.filledCells(), 2);
+    EXPECT_EQ(counter, 2);
+}
+
+TEST(EngineTest, NodeBudgetStopsSearch) {
+    Board b(6, 6, '*', 4);
+    Engine engine;
+    SearchLimits limits;
+    limits.maxNodes = 5000;
+    SearchResult r = engine.search(b, 0, limits);
+    EXPECT_LE(r.nodes, 5000 + 1024);
+    EXPECT_TRUE(b.checkCellAccess(r.row, r.col));
+}
+
+TEST(EngineTest, FindsFourInRowWinOnLargeBoard) {
+    Board b(15, 15, '*', 5);
+    int counter = 0;
+    int moves[7][2] = { {7, 7}, {0, 0}, {7, 8}, {0, 2}, {7, 9}, {14, 14}, {7, 10} };
+    for (auto& m : moves)
+        b.place(counter, m[0], m[1]);
+    b.place(counter, 14, 0);
+
+    Engine engine;
+    SearchLimits limits;
+    limits.maxMillis = 2000;
+    SearchResult r = engine.search(b, counter, limits);
+    EXPECT_EQ(r.row, 7);
+    EXPECT_TRUE(r.col == 6 || r.col == 11);
+    EXPECT_TRUE(Engine::isWinScore(r.score));
+}
+
+TEST(EngineTest, FullBoardHasNoMove) {
+    Board b(1, 1);
+    int counter = 0;
+    b.place(counter, 0, 0);
+    Engine engine;
+    SearchResult r = engine.search(b, counter, SearchLimits());
+    EXPECT_EQ(r.row, -1);
+}
+
+TEST(EngineTest, TableCutsRepeatedSearch) {
+    Board b(4, 4);
+    Engine engine;
+    SearchLimits limits;
+    limits.maxDepth = 6;
+    SearchResult first = engine.search(b, 0, limits);
+    SearchResult second = engine.search(b, 0, limits);
+    EXPECT_EQ(first.score, second.score);
+    EXPECT_LT(second.nodes, first.nodes);
+    EXPECT_GT(second.ttHitRate, 0.0);
+    EXPECT_GT(second.ttHits, 0u);
+    EXPECT_GE(second.ttProbes, second.ttHits);
+}
+
+TEST(EngineTest, LazySmpAgreesWithSingleThread) {
+    Board b(3, 3);
+    Engine engine;
+    SearchLimits limits;
+    limits.threads = 4;
+    SearchResult r = engine.search(b, 0, limits);
+    EXPECT_EQ(r.score, 0);
+    EXPECT_EQ(r.depth, 9);
+    EXPECT_EQ(r.threads, 4);
+    EXPECT_GT(r.nodesPerSecond, 0.0);
+    EXPECT_GT(r.ttProbes, 0u);
+    EXPECT_LE(r.ttHits, r.ttProbes);
+
+    int counter = 0;
+    b.place(counter, 0, 0);
+    b.place(counter, 1, 1);
+    b.place(counter, 0, 1);
+    r = engine.search(b, counter, limits);
+    EXPECT_EQ(r.row, 0);
+    EXPECT_EQ(r.col, 2);
+}
+
+TEST(EngineTest, DeterministicSplitIsRepeatable) {
+    Board b(4, 4);
+    int counter = 0;
+    b.place(counter, 1, 1);
+    SearchLimits limits;
+    limits.maxDepth = 6;
+    limits.threads = 3;
+    limits.deterministic = true;
+
+    Engine first, second;
+    SearchResult a = first.search(b, counter, limits);
+    SearchResult c = second.search(b, counter, limits);
+    SearchResult again = first.search(b, counter, limits);
+    EXPECT_EQ(a.pv, c.pv);
+    EXPECT_EQ(a.score, c.score);
+    EXPECT_EQ(a.nodes, c.nodes);
+    EXPECT_EQ(a.pv, again.pv);
+    EXPECT_EQ(a.nodes, again.nodes);
+
+    SearchLimits single = limits;
+    single.threads = 1;
+    Engine reference;
+    EXPECT_EQ(reference.search(b, counter, single).score, a.score);
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
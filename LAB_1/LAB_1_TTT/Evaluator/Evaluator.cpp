@@ -0,0 +1,262 @@
+#include "Evaluator.h"
+#include <algorithm>
+
+static const int DIRS[4][2] = { {0, 1}, {1, 0}, {1, 1}, {1, -1} };
+
+Evaluator::Evaluator(int width, int height, int k) {
+    if (width < 1 || height < 1) throw std::invalid_argument("       ");
+    width_ = width;
+    height_ = height;
+    k_ = k < 3 ? 3 : k;
+    cells_.assign(width_ * height_, 0);
+    for (int p = 0; p < 2; ++p) {
+        stones_[p].assign(4 * width_ * height_, 0);
+        counts_[p].assign(k_ + 1, 0);
+        completes_[p].assign(width_ * height_, 0);
+        winningCells_[p] = 0;
+    }
+    for (int d = 0; d < 4; ++d)
+        for (int i = 0; i < height_; ++i)
+            for (int j = 0; j < width_; ++j) {
+                int id;
+                if (windowStart(d, i, j, id)) {
+                    ++counts_[0][0];
+                    ++counts_[1][0];
+                }
+            }
+}
+
+Evaluator::Evaluator(const Board& board) : Evaluator(board.width(), board.height(), board.winLength()) {
+    for (int i = 0; i < height_; ++i)
+        for (int j = 0; j < width_; ++j) {
+            char c = board.at(i, j);
+            if (c == 'X' || c == 'O')
+                place(i, j, c);
+        }
+}
+
+void Evaluator::reset(const Board& board) {
+    *this = Evaluator(board);
+}
+
+int Evaluator::side(char player) {
+    return player == 'X' ? 0 : 1;
+}
+
+bool Evaluator::windowStart(int d, int i, int j, int& id) const {
+    int ei = i + DIRS[d][0] * (k_ - 1);
+    int ej = j + DIRS[d][1] * (k_ - 1);
+    if (i < 0 || i >= height_ || j < 0 || j >= width_ || ei < 0 || ei >= height_ || ej < 0 || ej >= width_)
+        return false;
+    id = (d * height_ + i) * width_ + j;
+    return true;
+}
+
+void Evaluator::addWindow(int id, int sign) {
+    int a = stones_[0][id];
+    int b = stones_[1][id];
+    if (b == 0)
+        counts_[0][a] += sign;
+    if (a == 0)
+        counts_[1][b] += sign;
+
+    int owner = -1;
+    if (a == k_ - 1 && b == 0)
+        owner = 0;
+    else if (b == k_ - 1 && a == 0)
+        owner = 1;
+    if (owner < 0)
+        return;
+
+    int d = id / (width_ * height_);
+    int start = id % (width_ * height_);
+    int i = start / width_, j = start % width_;
+    for (int s = 0; s < k_; ++s) {
+        int cell = (i + DIRS[d][0] * s) * width_ + (j + DIRS[d][1] * s);
+        if (cells_[cell])
+            continue;
+        int& c = completes_[owner][cell];
+        if (sign > 0 && c++ == 0)
+            ++winningCells_[owner];
+        else if (sign < 0 && --c == 0)
+            --winningCells_[owner];
+        break;
+    }
+}
+
+void Evaluator::place(int i, int j, char player) {
+    int cell = i * width_ + j;
+    if (i < 0 || i >= height_ || j < 0 || j >= width_ || cells_[cell]) throw std::logic_error("     ");
+
+    int p = side(player);
+    for (int d = 0; d < 4; ++d)
+        for (int s = 0; s < k_; ++s) {
+            int id;
+            if (windowStart(d, i - DIRS[d][0] * s, j - DIRS[d][1] * s, id))
+                addWindow(id, -1);
+        }
+    cells_[cell] = player;
+    for (int d = 0; d < 4; ++d)
+        for (int s = 0; s < k_; ++s) {
+            int id;
+            if (windowStart(d, i - DIRS[d][0] * s, j - DIRS[d][1] * s, id)) {
+                ++stones_[p][id];
+                addWindow(id, 1);
+            }
+        }
+}
+
+void Evaluator::unplace(int i, int j) {
+    int cell = i * width_ + j;
+    if (i < 0 || i >= height_ || j < 0 || j >= width_ || !cells_[cell]) throw std::logic_error("      ");
+
+    int p = side(cells_[cell]);
+    for (int d = 0; d < 4; ++d)
+        for (int s = 0; s < k_; ++s) {
+            int id;
+            if (windowStart(d, i - DIRS[d][0] * s, j - DIRS[d][1] * s, id))
+                addWindow(id, -1);
+        }
+    cells_[cell] = 0;
+    for (int d = 0; d < 4; ++d)
+        for (int s = 0; s < k_; ++s) {
+            int id;
+            if (windowStart(d, i - DIRS[d][0] * s, j - DIRS[d][1] * s, id)) {
+                --stones_[p][id];
+                addWindow(id, 1);
+            }
+        }
+}
+
+int Evaluator::width() const {
+    return width_;
+}
+
+int Evaluator::height() const {
+    return height_;
+}
+
+int Evaluator::winLength() const {
+    return k_;
+}
+
+char Evaluator::at(int i, int j) const {
+    return cells_[i * width_ + j];
+}
+
+int Evaluator::count(char player, int stones) const {
+    if (stones < 0 || stones > k_)
+        return 0;
+    return counts_[side(player)][stones];
+}
+
+bool Evaluator::isLive(int i, int j) const {
+    for (int d = 0; d < 4; ++d)
+        for (int s = 0; s < k_; ++s) {
+            int id;
+            if (windowStart(d, i - DIRS[d][0] * s, j - DIRS[d][1] * s, id) && (stones_[0][id] == 0 || stones_[1][id] == 0))
+                return true;
+        }
+    return false;
+}
+
+int Evaluator::winningCells(char player) const {
+    return winningCells_[side(player)];
+}
+
+bool Evaluator::hasDoubleThreat(char player) const {
+    return winningCells_[side(player)] >= 2;
+}
+
+int Evaluator::findWinningCell(char player) const {
+    int p = side(player);
+    if (winningCells_[p] == 0)
+        return -1;
+    for (int cell = 0; cell < width_ * height_; ++cell)
+        if (completes_[p][cell] > 0)
+            return cell;
+    return -1;
+}
+
+int Evaluator::evaluate(char toMove) const {
+    int me = side(toMove), opp = 1 - me;
+    if (winningCells_[me] > 0)
+        return THREAT_SCORE;
+    if (winningCells_[opp] >= 2)
+        return -THREAT_SCORE;
+
+    long long score = 0;
+    long long weight = 1;
+    for (int n = 1; n < k_; ++n) {
+        weight = std::min(weight * 4, 1LL << 20);
+        score += weight * (counts_[me][n] - counts_[opp][n]);
+    }
+    if (winningCells_[opp] == 1)
+        score -= weight;
+    return static_cast<int>(std::max(-THREAT_SCORE / 2LL, std::min(THREAT_SCORE / 2LL, score)));
+}
+
+bool Evaluator::threatSpaceSearch(char attacker, int maxDepth, std::vector<std::pair<int, int>>& line) {
+    std::vector<int> cells;
+    line.clear();
+    if (!tss(attacker, maxDepth, cells))
+        return false;
+    for (int cell : cells)
+        line.emplace_back(cell / width_, cell % width_);
+    return true;
+}
+
+bool Evaluator::tss(char attacker, int depth, std::vector<int>& line) {
+    char defender = attacker == 'X' ? 'O' : 'X';
+    int a = side(attacker);
+
+    int win = findWinningCell(attacker);
+    if (win >= 0) {
+        line.push_back(win);
+        return true;
+    }
+    if (winningCells_[1 - a] > 0 || depth == 0)
+        return false;
+
+    std::vector<int> candidates;
+    for (int cell = 0; cell < width_ * height_; ++cell) {
+        if (cells_[cell])
+            continue;
+        int ci = cell / width_, cj = cell % width_;
+        bool threat = false;
+        for (int d = 0; d < 4 && !threat; ++d)
+            for (int s = 0; s < k_; ++s) {
+                int id;
+                if (windowStart(d, ci - DIRS[d][0] * s, cj - DIRS[d][1] * s, id)
+                    && stones_[a][id] == k_ - 2 && stones_[1 - a][id] == 0) {
+                    threat = true;
+                    break;
+                }
+            }
+        if (threat)
+            candidates.push_back(cell);
+    }
+
+    for (int cell : candidates) {
+        int ci = cell / width_, cj = cell % width_;
+        place(ci, cj, attacker);
+        line.push_back(cell);
+        bool found = false;
+        if (winningCells_[a] >= 2)
+            found = true;
+        else if (winningCells_[a] == 1) {
+            int block = findWinningCell(attacker);
+            place(block / width_, block % width_, defender);
+            line.push_back(block);
+            found = tss(attacker, depth - 1, line);
+            if (!found)
+                line.pop_back();
+            unplace(block / width_, block % width_);
+        }
+        unplace(ci, cj);
+        if (found)
+            return true;
+        line.pop_back();
+    }
+    return false;
+}
@@ -0,0 +1,44 @@
+#pragma once
+#include <vector>
+#include <utility>
+#include <cstdint>
+#include "../Board/Board.h"
+
+class Evaluator {
+public:
+    static constexpr int THREAT_SCORE = 500000;
+
+    Evaluator(int width = 3, int height = 3, int k = 3);
+    explicit Evaluator(const Board& board);
+
+    void reset(const Board& board);
+    void place(int i, int j, char player);
+    void unplace(int i, int j);
+
+    int width() const;
+    int height() const;
+    int winLength() const;
+    char at(int i, int j) const;
+    int count(char player, int stones) const;
+    bool isLive(int i, int j) const;
+    int winningCells(char player) const;
+    bool hasDoubleThreat(char player) const;
+    int findWinningCell(char player) const;
+    int evaluate(char toMove) const;
+    bool threatSpaceSearch(char attacker, int maxDepth, std::vector<std::pair<int, int>>& line);
+
+private:
+    int width_;
+    int height_;
+    int k_;
+    std::vector<char> cells_;
+    std::vector<uint8_t> stones_[2];
+    std::vector<int> counts_[2];
+    std::vector<int> completes_[2];
+    int winningCells_[2];
+
+    static int side(char player);
+    bool windowStart(int d, int i, int j, int& id) const;
+    void addWindow(int id, int sign);
+    bool tss(char attacker, int depth, std::vector<int>& line);
+};
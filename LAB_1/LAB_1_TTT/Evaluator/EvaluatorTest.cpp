@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+#include <random>
+#include "Evaluator.h"
+
+TEST(EvaluatorTest, CountsLiveWindows) {
+    Evaluator e(5, 1, 3);
+    EXPECT_EQ(e.count('X', 0), 3);
+    e.place(0, 2, 'X');
+    EXPECT_EQ(e.count('X', 1), 3);
+    EXPECT_EQ(e.count('O', 0), 0);
+    e.place(0, 0, 'O');
+    EXPECT_EQ(e.count('X', 1), 2);
+    EXPECT_EQ(e.count('O', 1), 0);
+}
+
+TEST(EvaluatorTest, TracksWinningCells) {
+    Evaluator e(15, 15, 5);
+    e.place(7, 7, 'X');
+    e.place(7, 8, 'X');
+    e.place(7, 9, 'X');
+    EXPECT_EQ(e.winningCells('X'), 0);
+    e.place(7, 10, 'X');
+    EXPECT_EQ(e.winningCells('X'), 2);
+    EXPECT_TRUE(e.hasDoubleThreat('X'));
+    e.place(7, 6, 'O');
+    EXPECT_EQ(e.winningCells('X'), 1);
+    EXPECT_EQ(e.findWinningCell('X'), 7 * 15 + 11);
+    e.unplace(7, 6);
+    EXPECT_EQ(e.winningCells('X'), 2);
+}
+
+TEST(EvaluatorTest, IncrementalMatchesRebuild) {
+    std::mt19937 rng(3);
+    Board b(9, 9, '*', 4);
+    Evaluator e(9, 9, 4);
+    int counter = 0;
+    for (int n = 0; n < 40; ++n) {
+        int i = rng() % 9, j = rng() % 9;
+        if (!b.checkCellAccess(i, j))
+            continue;
+        char symbol = counter % 2 == 0 ? 'X' : 'O';
+        b.place(counter, i, j);
+        e.place(i, j, symbol);
+    }
+    Evaluator rebuilt(b);
+    for (int stones = 0; stones <= 4; ++stones) {
+        EXPECT_EQ(e.count('X', stones), rebuilt.count('X', stones));
+        EXPECT_EQ(e.count('O', stones), rebuilt.count('O', stones));
+    }
+    EXPECT_EQ(e.winningCells('X'), rebuilt.winningCells('X'));
+    EXPECT_EQ(e.winningCells('O'), rebuilt.winningCells('O'));
+    EXPECT_EQ(e.evaluate('X'), rebuilt.evaluate('X'));
+}
+
+TEST(EvaluatorTest, EvaluateIsSymmetric) {
+    Evaluator e(7, 7, 4);
+    e.place(3, 3, 'X');
+    e.place(0, 0, 'O');
+    EXPECT_GT(e.evaluate('X'), 0);
+    EXPECT_EQ(e.evaluate('X'), -e.evaluate('O'));
+    e.place(3, 4, 'X');
+    e.place(3, 5, 'X');
+    EXPECT_EQ(e.evaluate('X'), Evaluator::THREAT_SCORE);
+}
+
+TEST(EvaluatorTest, ThreatSpaceSearchFindsForcedWin) {
+    Evaluator e(15, 15, 5);
+    e.place(7, 6, 'O');
+    e.place(7, 7, 'X');
+    e.place(7, 8, 'X');
+    e.place(7, 9, 'X');
+    e.place(4, 10, 'X');
+    e.place(5, 10, 'X');
+    e.place(6, 10, 'X');
+    e.place(3, 10, 'O');
+    e.place(0, 0, 'O');
+    e.place(14, 14, 'O');
+
+    std::vector<std::pair<int, int>> line;
+    ASSERT_TRUE(e.threatSpaceSearch('X', 4, line));
+    ASSERT_FALSE(line.empty());
+    EXPECT_EQ(line[0], std::make_pair(7, 10));
+    EXPECT_EQ(e.at(7, 10), 0);
+    EXPECT_EQ(e.winningCells('X'), 0);
+    EXPECT_FALSE(e.threatSpaceSearch('O', 4, line));
+}
+
+TEST(EvaluatorTest, RejectsOccupiedCell) {
+    Evaluator e(3, 3, 3);
+    e.place(1, 1, 'X');
+    EXPECT_THROW(e.place(1, 1, 'O'), std::logic_error);
+    EXPECT_THROW(e.unplace(0, 0), std::logic_error);
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
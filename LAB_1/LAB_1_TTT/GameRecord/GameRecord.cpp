@@ -0,0 +1,198 @@
+#include "GameRecord.h"
+#include <cstring>
+#include <stdexcept>
+
+static const char MAGIC[4] = { 'T', 'T', 'T', 'G' };
+static const int FILE_HEADER = 8;
+static const int BLOCK_HEADER = 8;
+
+static void putU32(uint8_t* p, uint32_t value) {
+    for (int b = 0; b < 4; ++b)
+        p[b] = static_cast<uint8_t>(value >> (8 * b));
+}
+
+static uint32_t getU32(const uint8_t* p) {
+    return p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+void GameRecorder::onPlace(const Board& board, int i, int j, char) {
+    if (record_.moves.empty()) {
+        record_.width = board.width();
+        record_.height = board.height();
+        record_.k = board.winLength();
+    }
+    record_.moves.push_back(i * board.width() + j);
+}
+
+void GameRecorder::onUnplace(const Board& board, int i, int j) {
+    if (!record_.moves.empty() && record_.moves.back() == i * board.width() + j)
+        record_.moves.pop_back();
+}
+
+const GameRecord& GameRecorder::record() const {
+    return record_;
+}
+
+void GameRecorder::clear() {
+    record_ = GameRecord();
+}
+
+GameRecordWriter::GameRecordWriter(const std::string& path, size_t blockBytes)
+    : out_(path, std::ios::binary | std::ios::trunc), path_(path), blockBytes_(blockBytes), blockRecords_(0), records_(0) {
+    if (!out_)
+        throw std::runtime_error("   : " + path);
+    uint8_t header[FILE_HEADER] = {};
+    std::memcpy(header, MAGIC, 4);
+    putU32(header + 4, 1);
+    out_.write(reinterpret_cast<const char*>(header), FILE_HEADER);
+    block_.resize(BLOCK_HEADER);
+}
+
+GameRecordWriter::~GameRecordWriter() {
+    try {
+        flush();
+    }
+    catch (...) {
+    }
+}
+
+void GameRecordWriter::putVarint(std::vector<uint8_t>& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+void GameRecordWriter::write(const GameRecord& record) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    putVarint(block_, record.width);
+    putVarint(block_, record.height);
+    putVarint(block_, record.k);
+    putVarint(block_, record.moves.size());
+    for (int cell : record.moves)
+        putVarint(block_, static_cast<uint64_t>(cell));
+    ++blockRecords_;
+    ++records_;
+    if (block_.size() >= blockBytes_)
+        flushLocked();
+}
+
+void GameRecordWriter::flush() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    flushLocked();
+    out_.flush();
+}
+
+void GameRecordWriter::flushLocked() {
+    if (blockRecords_ == 0)
+        return;
+    putU32(&block_[0], static_cast<uint32_t>(block_.size() - BLOCK_HEADER));
+    putU32(&block_[4], blockRecords_);
+    out_.write(reinterpret_cast<const char*>(block_.data()), static_cast<std::streamsize>(block_.size()));
+    if (!out_)
+        throw std::runtime_error("  : " + path_);
+    block_.resize(BLOCK_HEADER);
+    blockRecords_ = 0;
+}
+
+long long GameRecordWriter::recordsWritten() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return records_;
+}
+
+GameRecordView::MoveCursor::MoveCursor(const uint8_t* data, int remaining) : data_(data), remaining_(remaining) {}
+
+bool GameRecordView::MoveCursor::next(int& cell) {
+    if (remaining_ == 0)
+        return false;
+    uint32_t value = 0;
+    int shift = 0;
+    uint8_t byte;
+    do {
+        byte = *data_++;
+        value |= static_cast<uint32_t>(byte & 0x7F) << shift;
+        shift += 7;
+    } while (byte & 0x80);
+    cell = static_cast<int>(value);
+    --remaining_;
+    return true;
+}
+
+GameRecordView::MoveCursor GameRecordView::moves() const {
+    return MoveCursor(moves_, moveCount);
+}
+
+bool GameRecordView::replay(Board& board, char& result) const {
+    if (board.width() != width || board.height() != height || board.winLength() != k)
+        return false;
+    int counter = board.filledCells();
+    result = '*';
+    MoveCursor cursor = moves();
+    int cell;
+    while (cursor.next(cell))
+        result = board.place(counter, cell / width, cell % width);
+    return true;
+}
+
+GameRecordReader::GameRecordReader() : cursor_(nullptr), blockEnd_(nullptr), blockRecords_(0) {}
+
+GameRecordReader::GameRecordReader(const std::string& path) : GameRecordReader() {
+    open(path);
+}
+
+void GameRecordReader::open(const std::string& path) {
+    file_.open(path);
+    if (file_.size() < FILE_HEADER || std::memcmp(file_.data(), MAGIC, 4) != 0 || getU32(file_.data() + 4) != 1) {
+        file_.close();
+        throw std::runtime_error("   : " + path);
+    }
+    rewind();
+}
+
+void GameRecordReader::rewind() {
+    cursor_ = file_.data() + FILE_HEADER;
+    blockEnd_ = cursor_;
+    blockRecords_ = 0;
+}
+
+bool GameRecordReader::getVarint(const uint8_t*& p, const uint8_t* end, uint64_t& value) {
+    value = 0;
+    for (int shift = 0; p < end && shift < 64; shift += 7) {
+        uint8_t byte = *p++;
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if (!(byte & 0x80))
+            return true;
+    }
+    return false;
+}
+
+bool GameRecordReader::next(GameRecordView& view) {
+    const uint8_t* fileEnd = file_.data() + file_.size();
+    while (blockRecords_ == 0) {
+        cursor_ = blockEnd_;
+        if (fileEnd - cursor_ < BLOCK_HEADER)
+            return false;
+        uint32_t size = getU32(cursor_);
+        blockRecords_ = getU32(cursor_ + 4);
+        cursor_ += BLOCK_HEADER;
+        if (static_cast<size_t>(fileEnd - cursor_) < size)
+            throw std::runtime_error("  ");
+        blockEnd_ = cursor_ + size;
+    }
+
+    uint64_t w, h, k, count;
+    if (!getVarint(cursor_, blockEnd_, w) || !getVarint(cursor_, blockEnd_, h)
+        || !getVarint(cursor_, blockEnd_, k) || !getVarint(cursor_, blockEnd_, count))
+        throw std::runtime_error("  ");
+    view.width = static_cast<int>(w);
+    view.height = static_cast<int>(h);
+    view.k = static_cast<int>(k);
+    view.moveCount = static_cast<int>(count);
+    view.moves_ = cursor_;
+    for (uint64_t n = 0, cell; n < count; ++n)
+        if (!getVarint(cursor_, blockEnd_, cell))
+            throw std::runtime_error("  ");
+    --blockRecords_;
+    return true;
+}
@@ -0,0 +1,97 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <fstream>
+#include <mutex>
+#include <cstdint>
+#include <cstddef>
+#include "../Board/Board.h"
+#include "../MappedFile/MappedFile.h"
+
+struct GameRecord {
+    int width = 0;
+    int height = 0;
+    int k = 0;
+    std::vector<int> moves;
+};
+
+class GameRecorder : public BoardListener {
+public:
+    void onPlace(const Board& board, int i, int j, char symbol) override;
+    void onUnplace(const Board& board, int i, int j) override;
+    const GameRecord& record() const;
+    void clear();
+
+private:
+    GameRecord record_;
+};
+
+class GameRecordWriter {
+public:
+    static constexpr size_t DEFAULT_BLOCK_BYTES = 1 << 16;
+
+    explicit GameRecordWriter(const std::string& path, size_t blockBytes = DEFAULT_BLOCK_BYTES);
+    GameRecordWriter(const GameRecordWriter&) = delete;
+    GameRecordWriter& operator=(const GameRecordWriter&) = delete;
+    ~GameRecordWriter();
+
+    void write(const GameRecord& record);
+    void flush();
+    long long recordsWritten() const;
+
+    static void putVarint(std::vector<uint8_t>& out, uint64_t value);
+
+private:
+    std::ofstream out_;
+    std::string path_;
+    size_t blockBytes_;
+    std::vector<uint8_t> block_;
+    uint32_t blockRecords_;
+    long long records_;
+    mutable std::mutex mutex_;
+
+    void flushLocked();
+};
+
+class GameRecordView {
+public:
+    int width = 0;
+    int height = 0;
+    int k = 0;
+    int moveCount = 0;
+
+    class MoveCursor {
+    public:
+        MoveCursor(const uint8_t* data, int remaining);
+        bool next(int& cell);
+
+    private:
+        const uint8_t* data_;
+        int remaining_;
+    };
+
+    MoveCursor moves() const;
+    bool replay(Board& board, char& result) const;
+
+private:
+    friend class GameRecordReader;
+    const uint8_t* moves_ = nullptr;
+};
+
+class GameRecordReader {
+public:
+    GameRecordReader();
+    explicit GameRecordReader(const std::string& path);
+
+    void open(const std::string& path);
+    bool next(GameRecordView& view);
+    void rewind();
+
+    static bool getVarint(const uint8_t*& p, const uint8_t* end, uint64_t& value);
+
+private:
+    MappedFile file_;
+    const uint8_t* cursor_;
+    const uint8_t* blockEnd_;
+    uint32_t blockRecords_;
+};
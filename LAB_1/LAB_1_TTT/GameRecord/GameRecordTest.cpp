@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include "GameRecord.h"
+
+TEST(GameRecordTest, VarintRoundTrip) {
+    std::vector<uint8_t> bytes;
+    uint64_t values[5] = { 0, 127, 128, 999999, 1ULL << 40 };
+    for (uint64_t v : values)
+        GameRecordWriter::putVarint(bytes, v);
+    EXPECT_EQ(bytes.size(), 1u + 1 + 2 + 3 + 6);
+
+    const uint8_t* p = bytes.data();
+    for (uint64_t v : values) {
+        uint64_t decoded;
+        ASSERT_TRUE(GameRecordReader::getVarint(p, bytes.data() + bytes.size(), decoded));
+        EXPECT_EQ(decoded, v);
+    }
+    uint64_t extra;
+    EXPECT_FALSE(GameRecordReader::getVarint(p, bytes.data() + bytes.size(), extra));
+}
+
+TEST(GameRecordTest, RecorderFollowsBoard) {
+    Board b(4, 4);
+    GameRecorder recorder;
+    b.setListener(&recorder);
+    int counter = 0;
+    b.place(counter, 1, 1);
+    b.place(counter, 2, 3);
+    b.place(counter, 0, 0);
+    b.unplace(counter, 0, 0);
+    b.place(counter, 3, 0);
+
+    const GameRecord& r = recorder.record();
+    EXPECT_EQ(r.width, 4);
+    EXPECT_EQ(r.k, 3);
+    EXPECT_EQ(r.moves, std::vector<int>({ 5, 11, 12 }));
+}
+
+TEST(GameRecordTest, WriteAndStreamBack) {
+    const char* path = "game_record_test.bin";
+    {
+        GameRecordWriter writer(path, 64);
+        for (int g = 0; g < 100; ++g) {
+            GameRecord r;
+            r.width = 300;
+            r.height = 200;
+            r.k = 5;
+            for (int m = 0; m < g % 7; ++m)
+                r.moves.push_back(g * 1000 + m);
+            writer.write(r);
+        }
+        EXPECT_EQ(writer.recordsWritten(), 100);
+    }
+
+    GameRecordReader reader(path);
+    GameRecordView view;
+    int g = 0;
+    while (reader.next(view)) {
+        EXPECT_EQ(view.width, 300);
+        EXPECT_EQ(view.height, 200);
+        EXPECT_EQ(view.k, 5);
+        ASSERT_EQ(view.moveCount, g % 7);
+        GameRecordView::MoveCursor cursor = view.moves();
+        int cell, m = 0;
+        while (cursor.next(cell))
+            EXPECT_EQ(cell, g * 1000 + m++);
+        ++g;
+    }
+    EXPECT_EQ(g, 100);
+    reader.rewind();
+    EXPECT_TRUE(reader.next(view));
+    std::remove(path);
+}
+
+TEST(GameRecordTest, ReplayReachesResult) {
+    const char* path = "game_record_replay.bin";
+    {
+        GameRecordWriter writer(path);
+        Board b(3, 3);
+        GameRecorder recorder;
+        b.setListener(&recorder);
+        int counter = 0;
+        int moves[5][2] = { {0, 0}, {1, 0}, {0, 1}, {1, 1}, {0, 2} };
+        for (auto& m : moves)
+            b.place(counter, m[0], m[1]);
+        writer.write(recorder.record());
+    }
+
+    GameRecordReader reader(path);
+    GameRecordView view;
+    ASSERT_TRUE(reader.next(view));
+    Board b(view.width, view.height, '*', view.k);
+    char result;
+    ASSERT_TRUE(view.replay(b, result));
+    EXPECT_EQ(result, 'X');
+    Board other(4, 4);
+    EXPECT_FALSE(view.replay(other, result));
+    EXPECT_FALSE(reader.next(view));
+    std::remove(path);
+}
+
+TEST(GameRecordTest, RejectsForeignFile) {
+    const char* path = "game_record_bad.bin";
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << "not a record file";
+    }
+    GameRecordReader reader;
+    EXPECT_THROW(reader.open(path), std::runtime_error);
+    std::remove(path);
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,147 @@
+#include "GameServer.h"
+#include <sstream>
+#include <stdexcept>
+
+GameServer::GameServer(std::ostream& output, size_t maxGames) : out_(output), maxGames_(maxGames), moves_(0) {
+}
+
+size_t GameServer::gameCount() const {
+    return games_.size();
+}
+
+long long GameServer::movesPlayed() const {
+    return moves_;
+}
+
+void GameServer::reply(const std::string& line) {
+    out_ << line << '\n';
+}
+
+void GameServer::error(const std::string& id, const std::string& message) {
+    reply("ERROR " + (id.empty() ? std::string("-") : id) + ' ' + message);
+}
+
+GameServer::Game* GameServer::find(const std::string& id) {
+    auto it = games_.find(id);
+    if (it == games_.end()) {
+        error(id, " ");
+        return nullptr;
+    }
+    return &it->second;
+}
+
+void GameServer::newGame(std::istringstream& args) {
+    std::string id;
+    int w = 3, h = 3, k = 3;
+    if (!(args >> id)) {
+        error("", "   ");
+        return;
+    }
+    args >> w >> h >> k;
+    if (games_.count(id)) {
+        error(id, "  ");
+        return;
+    }
+    if (maxGames_ > 0 && games_.size() >= maxGames_) {
+        error(id, "  ");
+        return;
+    }
+    try {
+        games_.emplace(id, Game{ Board(w, h, '*', k), 0, '*' });
+    }
+    catch (const std::exception& ex) {
+        error(id, ex.what());
+        return;
+    }
+    reply("OK " + id);
+}
+
+void GameServer::move(std::istringstream& args) {
+    std::string id;
+    int i = 0, j = 0;
+    if (!(args >> id >> i >> j)) {
+        error(id, "  ");
+        return;
+    }
+    Game* game = find(id);
+    if (!game)
+        return;
+    if (game->result != '*') {
+        error(id, " ");
+        return;
+    }
+    char symbol = game->counter % 2 == 0 ? 'X' : 'O';
+    try {
+        game->result = game->board.place(game->counter, i, j);
+    }
+    catch (const std::exception& ex) {
+        error(id, ex.what());
+        return;
+    }
+    ++moves_;
+    std::ostringstream line;
+    line << "OK " << id << ' ' << symbol << ' ' << game->result;
+    reply(line.str());
+}
+
+void GameServer::show(std::istringstream& args) {
+    std::string id;
+    args >> id;
+    Game* game = find(id);
+    if (!game)
+        return;
+    const Board& b = game->board;
+    std::string cells;
+    cells.reserve(static_cast<size_t>(b.width()) * b.height());
+    for (int i = 0; i < b.height(); ++i)
+        cells.append(b[i], b.width());
+    std::ostringstream line;
+    line << "BOARD " << id << ' ' << b.width() << ' ' << b.height() << ' ' << b.winLength() << ' '
+        << game->counter << ' ' << game->result << ' ' << cells;
+    reply(line.str());
+}
+
+void GameServer::endGame(std::istringstream& args) {
+    std::string id;
+    args >> id;
+    if (games_.erase(id) == 0) {
+        error(id, " ");
+        return;
+    }
+    reply("OK " + id);
+}
+
+bool GameServer::handle(const std::string& line) {
+    std::istringstream args(line);
+    std::string command;
+    if (!(args >> command))
+        return true;
+
+    if (command == "QUIT")
+        return false;
+    if (command == "NEW")
+        newGame(args);
+    else if (command == "MOVE")
+        move(args);
+    else if (command == "SHOW")
+        show(args);
+    else if (command == "END")
+        endGame(args);
+    else
+        error("", " : " + command);
+    return true;
+}
+
+void GameServer::serve(std::istream& in) {
+    std::string line;
+    while (std::getline(in, line)) {
+        if (!line.empty() && line.back() == '\r')
+            line.pop_back();
+        bool more = handle(line);
+        if (in.rdbuf()->in_avail() <= 0)
+            out_.flush();
+        if (!more)
+            break;
+    }
+    out_.flush();
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include <string>
+#include <unordered_map>
+#include <istream>
+#include <sstream>
+#include <ostream>
+#include <cstddef>
+#include "../Board/Board.h"
+
+class GameServer {
+public:
+    explicit GameServer(std::ostream& output, size_t maxGames = 0);
+    GameServer(const GameServer&) = delete;
+    GameServer& operator=(const GameServer&) = delete;
+
+    bool handle(const std::string& line);
+    void serve(std::istream& in);
+
+    size_t gameCount() const;
+    long long movesPlayed() const;
+
+private:
+    struct Game {
+        Board board;
+        int counter;
+        char result;
+    };
+
+    std::ostream& out_;
+    size_t maxGames_;
+    long long moves_;
+    std::unordered_map<std::string, Game> games_;
+
+    void reply(const std::string& line);
+    void error(const std::string& id, const std::string& message);
+    Game* find(const std::string& id);
+
+    void newGame(std::istringstream& args);
+    void move(std::istringstream& args);
+    void show(std::istringstream& args);
+    void endGame(std::istringstream& args);
+};
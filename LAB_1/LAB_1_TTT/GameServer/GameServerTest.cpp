@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <vector>
+#include "GameServer.h"
+
+static std::vector<std::string> lines(const std::string& text) {
+    std::vector<std::string> result;
+    std::istringstream in(text);
+    std::string line;
+    while (std::getline(in, line))
+        result.push_back(line);
+    return result;
+}
+
+TEST(GameServerTest, PlaysGameToWin) {
+    std::istringstream in("NEW g1\nMOVE g1 0 0\nMOVE g1 1 0\nMOVE g1 0 1\nMOVE g1 1 1\nMOVE g1 0 2\nMOVE g1 2 2\nQUIT\nNEW late\n");
+    std::ostringstream out;
+    GameServer server(out);
+    server.serve(in);
+    auto replies = lines(out.str());
+    ASSERT_EQ(replies.size(), 7u);
+    EXPECT_EQ(replies[0], "OK g1");
+    EXPECT_EQ(replies[1], "OK g1 X *");
+    EXPECT_EQ(replies[2], "OK g1 O *");
+    EXPECT_EQ(replies[5], "OK g1 X X");
+    EXPECT_EQ(replies[6].rfind("ERROR g1", 0), 0u);
+    EXPECT_EQ(server.movesPlayed(), 5);
+    EXPECT_EQ(server.gameCount(), 1u);
+}
+
+TEST(GameServerTest, RejectsBadRequests) {
+    std::ostringstream out;
+    GameServer server(out, 1);
+    server.handle("MOVE nope 0 0");
+    server.handle("NEW a 0 3 3");
+    server.handle("NEW a 3 3 3");
+    server.handle("NEW a");
+    server.handle("NEW b");
+    server.handle("MOVE a 5 5");
+    server.handle("MOVE a 1 1");
+    server.handle("MOVE a 1 1");
+    server.handle("JUMP a");
+    auto replies = lines(out.str());
+    ASSERT_EQ(replies.size(), 9u);
+    EXPECT_EQ(replies[0].rfind("ERROR nope", 0), 0u);
+    EXPECT_EQ(replies[1].rfind("ERROR a", 0), 0u);
+    EXPECT_EQ(replies[2], "OK a");
+    EXPECT_EQ(replies[3].rfind("ERROR a", 0), 0u);
+    EXPECT_EQ(replies[4].rfind("ERROR b", 0), 0u);
+    EXPECT_EQ(replies[5].rfind("ERROR a", 0), 0u);
+    EXPECT_EQ(replies[6], "OK a X *");
+    EXPECT_EQ(replies[7].rfind("ERROR a", 0), 0u);
+    EXPECT_EQ(replies[8].rfind("ERROR -", 0), 0u);
+}
+
+TEST(GameServerTest, ShowAndEnd) {
+    std::ostringstream out;
+    GameServer server(out);
+    server.handle("NEW big 15 15 5");
+    server.handle("MOVE big 7 7");
+    server.handle("SHOW big");
+    server.handle("END big");
+    server.handle("SHOW big");
+    auto replies = lines(out.str());
+    ASSERT_EQ(replies.size(), 5u);
+    std::string cells(225, '*');
+    cells[7 * 15 + 7] = 'X';
+    EXPECT_EQ(replies[2], "BOARD big 15 15 5 1 * " + cells);
+    EXPECT_EQ(replies[3], "OK big");
+    EXPECT_EQ(replies[4].rfind("ERROR big", 0), 0u);
+    EXPECT_EQ(server.gameCount(), 0u);
+}
+
+TEST(GameServerTest, HostsManyGames) {
+    std::ostringstream out;
+    GameServer server(out);
+    const int games = 5000;
+    for (int g = 0; g < games; ++g)
+        server.handle("NEW g" + std::to_string(g) + " 7 7 5");
+    for (int m = 0; m < 9; ++m)
+        for (int g = 0; g < games; ++g)
+            server.handle("MOVE g" + std::to_string(g) + ' ' + std::to_string(m % 2 ? 6 : m / 2) + ' ' + std::to_string((m / 2 + g) % 7));
+    EXPECT_EQ(server.gameCount(), static_cast<size_t>(games));
+    EXPECT_EQ(server.movesPlayed(), 9LL * games);
+    EXPECT_EQ(out.str().find("ERROR"), std::string::npos);
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,100 @@
+#include "MappedFile.h"
+#include <stdexcept>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+MappedFile::MappedFile() : file_(INVALID_HANDLE_VALUE), mapping_(nullptr), data_(nullptr), size_(0) {}
+#else
+MappedFile::MappedFile() : fd_(-1), data_(nullptr), size_(0) {}
+#endif
+
+MappedFile::MappedFile(const std::string& path) : MappedFile() {
+    open(path);
+}
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+void MappedFile::open(const std::string& path) {
+    close();
+#ifdef _WIN32
+    file_ = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file_ == INVALID_HANDLE_VALUE)
+        throw std::runtime_error("   : " + path);
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file_, &size)) {
+        close();
+        throw std::runtime_error("    : " + path);
+    }
+    size_ = static_cast<size_t>(size.QuadPart);
+    if (size_ == 0)
+        return;
+    mapping_ = CreateFileMappingA(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping_)
+        data_ = static_cast<const uint8_t*>(MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+#else
+    fd_ = ::open(path.c_str(), O_RDONLY);
+    if (fd_ < 0)
+        throw std::runtime_error("   : " + path);
+    struct stat st;
+    if (fstat(fd_, &st) != 0) {
+        close();
+        throw std::runtime_error("    : " + path);
+    }
+    size_ = static_cast<size_t>(st.st_size);
+    if (size_ == 0)
+        return;
+    void* view = mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd_, 0);
+    if (view != MAP_FAILED)
+        data_ = static_cast<const uint8_t*>(view);
+#endif
+    if (!data_) {
+        close();
+        throw std::runtime_error("     : " + path);
+    }
+}
+
+void MappedFile::close() {
+#ifdef _WIN32
+    if (data_)
+        UnmapViewOfFile(data_);
+    if (mapping_)
+        CloseHandle(mapping_);
+    if (file_ != INVALID_HANDLE_VALUE)
+        CloseHandle(file_);
+    file_ = INVALID_HANDLE_VALUE;
+    mapping_ = nullptr;
+#else
+    if (data_)
+        munmap(const_cast<uint8_t*>(data_), size_);
+    if (fd_ >= 0)
+        ::close(fd_);
+    fd_ = -1;
+#endif
+    data_ = nullptr;
+    size_ = 0;
+}
+
+bool MappedFile::isOpen() const {
+#ifdef _WIN32
+    return file_ != INVALID_HANDLE_VALUE;
+#else
+    return fd_ >= 0;
+#endif
+}
+
+const uint8_t* MappedFile::data() const {
+    return data_;
+}
+
+size_t MappedFile::size() const {
+    return size_;
+}
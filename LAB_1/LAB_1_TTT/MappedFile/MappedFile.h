@@ -0,0 +1,29 @@
+#pragma once
+#include <string>
+#include <cstddef>
+#include <cstdint>
+
+class MappedFile {
+public:
+    MappedFile();
+    explicit MappedFile(const std::string& path);
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    ~MappedFile();
+
+    void open(const std::string& path);
+    void close();
+    bool isOpen() const;
+    const uint8_t* data() const;
+    size_t size() const;
+
+private:
+#ifdef _WIN32
+    void* file_;
+    void* mapping_;
+#else
+    int fd_;
+#endif
+    const uint8_t* data_;
+    size_t size_;
+};
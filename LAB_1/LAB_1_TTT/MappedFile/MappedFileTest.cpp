@@ -0,0 +1,44 @@
+#include <gtest/gtest.h>
+#include <fstream>
+#include <cstdio>
+#include "MappedFile.h"
+
+TEST(MappedFileTest, MapsFileContents) {
+    const char* path = "mapped_file_test.bin";
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << "hello";
+    }
+    {
+        MappedFile file(path);
+        ASSERT_TRUE(file.isOpen());
+        ASSERT_EQ(file.size(), 5u);
+        EXPECT_EQ(std::string(reinterpret_cast<const char*>(file.data()), file.size()), "hello");
+        file.close();
+        EXPECT_FALSE(file.isOpen());
+        EXPECT_EQ(file.data(), nullptr);
+    }
+    std::remove(path);
+}
+
+TEST(MappedFileTest, EmptyFileHasNoData) {
+    const char* path = "mapped_file_empty.bin";
+    { std::ofstream out(path, std::ios::binary); }
+    {
+        MappedFile file(path);
+        EXPECT_TRUE(file.isOpen());
+        EXPECT_EQ(file.size(), 0u);
+    }
+    std::remove(path);
+}
+
+TEST(MappedFileTest, MissingFileThrows) {
+    MappedFile file;
+    EXPECT_THROW(file.open("no_such_file.bin"), std::runtime_error);
+    EXPECT_FALSE(file.isOpen());
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,331 @@
+#include "Mcts.h"
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+static char opponent(char player) {
+    return player == 'X' ? 'O' : 'X';
+}
+
+//      (     ),  
+//         
+void Mcts::PlayoutBoard::load(const Board& board) {
+    width = board.width();
+    height = board.height();
+    k = board.winLength();
+    stride = width + 1;
+    filled = 0;
+    cells.assign((height + 2) * stride + 2, '#');
+    empties.clear();
+    slot.assign(cells.size(), -1);
+    for (int i = 0; i < height; ++i)
+        for (int j = 0; j < width; ++j) {
+            char c = board.at(i, j);
+            int p = pad(i * width + j);
+            if (c == 'X' || c == 'O') {
+                cells[p] = c;
+                ++filled;
+            }
+            else {
+                cells[p] = 0;
+                slot[p] = static_cast<int>(empties.size());
+                empties.push_back(p);
+            }
+        }
+}
+
+bool Mcts::PlayoutBoard::wins(int p, char player) const {
+    const int dirs[4] = { 1, stride, stride + 1, stride - 1 };
+    const char* c = cells.data();
+    for (int d : dirs) {
+        int run = 1;
+        for (int q = p + d; c[q] == player && run < k; q += d)
+            ++run;
+        for (int q = p - d; c[q] == player && run < k; q -= d)
+            ++run;
+        if (run >= k)
+            return true;
+    }
+    return false;
+}
+
+char Mcts::PlayoutBoard::play(int p, char player) {
+    cells[p] = player;
+    int at = slot[p];
+    int last = empties.back();
+    empties[at] = last;
+    slot[last] = at;
+    empties.pop_back();
+    slot[p] = -1;
+    ++filled;
+    if (filled >= 2 * k - 1 && wins(p, player))
+        return player;
+    if (empties.empty())
+        return 'D';
+    return '*';
+}
+
+Mcts::Mcts(size_t nodesPerTree) : capacity_(nodesPerTree < 2 ? 2 : nodesPerTree), rootHash_(0), rootShape_(-1) {}
+
+void Mcts::clear() {
+    trees_.clear();
+    rootShape_ = -1;
+}
+
+size_t Mcts::nodeCount() const {
+    size_t total = 0;
+    for (const Tree& tree : trees_)
+        total += tree.nodes.size();
+    return total;
+}
+
+void Mcts::compact(Tree& tree, int newRoot) {
+    std::vector<Node> fresh;
+    fresh.reserve(capacity_);
+    fresh.push_back(tree.nodes[newRoot]);
+    fresh[0].parent = -1;
+    for (size_t n = 0; n < fresh.size(); ++n) {
+        if (!fresh[n].expanded)
+            continue;
+        int oldFirst = fresh[n].firstChild;
+        int count = fresh[n].childCount;
+        fresh[n].firstChild = static_cast<int>(fresh.size());
+        for (int c = 0; c < count; ++c) {
+            Node child = tree.nodes[oldFirst + c];
+            child.parent = static_cast<int>(n);
+            fresh.push_back(child);
+        }
+    }
+    tree.nodes.swap(fresh);
+    tree.root = 0;
+}
+
+bool Mcts::reroot(Tree& tree, uint64_t target) {
+    if (tree.root < 0)
+        return false;
+    if (rootHash_ == target)
+        return true;
+
+    const Node& root = tree.nodes[tree.root];
+    for (int c = 0; root.expanded && c < root.childCount; ++c) {
+        int childIndex = root.firstChild + c;
+        const Node& child = tree.nodes[childIndex];
+        uint64_t afterChild = rootHash_ ^ Board::zobristKey(child.move, child.player);
+        if (afterChild == target) {
+            compact(tree, childIndex);
+            return true;
+        }
+        for (int g = 0; child.expanded && g < child.childCount; ++g) {
+            int grandIndex = child.firstChild + g;
+            const Node& grand = tree.nodes[grandIndex];
+            if ((afterChild ^ Board::zobristKey(grand.move, grand.player)) == target) {
+                compact(tree, grandIndex);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void Mcts::prepareTree(Tree& tree, char justMoved) {
+    tree.nodes.clear();
+    tree.nodes.reserve(capacity_);
+    tree.nodes.push_back(Node{ -1, -1, -1, 0, 0, 0.0f, justMoved, 0, false });
+    tree.root = 0;
+}
+
+void Mcts::expand(Tree& tree, int node, const PlayoutBoard& pb) {
+    std::vector<int>& moves = tree.moves;
+    moves.clear();
+    if (pb.width * pb.height <= 64) {
+        for (int p : pb.empties)
+            moves.push_back(pb.unpad(p));
+    }
+    else if (pb.filled == 0)
+        moves.push_back((pb.height / 2) * pb.width + pb.width / 2);
+    else {
+        std::vector<char>& near = tree.near;
+        near.assign(pb.cells.size(), 0);
+        for (int i = 0; i < pb.height; ++i)
+            for (int j = 0; j < pb.width; ++j) {
+                char c = pb.cells[pb.pad(i * pb.width + j)];
+                if (c != 'X' && c != 'O')
+                    continue;
+                for (int ni = std::max(0, i - 2); ni <= std::min(pb.height - 1, i + 2); ++ni)
+                    for (int nj = std::max(0, j - 2); nj <= std::min(pb.width - 1, j + 2); ++nj)
+                        near[pb.pad(ni * pb.width + nj)] = 1;
+            }
+        for (int p : pb.empties)
+            if (near[p])
+                moves.push_back(pb.unpad(p));
+    }
+    if (moves.empty() || tree.nodes.size() + moves.size() > capacity_)
+        return;
+
+    std::shuffle(moves.begin(), moves.end(), tree.rng);
+    char player = opponent(tree.nodes[node].player);
+    int first = static_cast<int>(tree.nodes.size());
+    for (int m : moves)
+        tree.nodes.push_back(Node{ m, node, -1, 0, 0, 0.0f, player, 0, false });
+    tree.nodes[node].firstChild = first;
+    tree.nodes[node].childCount = static_cast<int>(moves.size());
+    tree.nodes[node].expanded = true;
+}
+
+char Mcts::rollout(Tree& tree, char toMove) {
+    PlayoutBoard& pb = tree.scratch;
+    char player = toMove;
+    while (!pb.empties.empty()) {
+        uint64_t draw = static_cast<uint32_t>(tree.rng()) * static_cast<uint64_t>(pb.empties.size());
+        char result = pb.play(pb.empties[static_cast<size_t>(draw >> 32)], player);
+        if (result != '*')
+            return result;
+        player = opponent(player);
+    }
+    return 'D';
+}
+
+void Mcts::simulate(Tree& tree, double exploration) {
+    PlayoutBoard& pb = tree.scratch;
+    pb = tree.start;
+
+    int node = tree.root;
+    char outcome = 0;
+    for (;;) {
+        if (tree.nodes[node].result) {
+            outcome = tree.nodes[node].result;
+            break;
+        }
+        if (!tree.nodes[node].expanded) {
+            if (tree.nodes[node].visits == 0 && node != tree.root)
+                break;
+            expand(tree, node, pb);
+            if (!tree.nodes[node].expanded)
+                break;
+        }
+
+        const Node& current = tree.nodes[node];
+        float explore = static_cast<float>(exploration * std::sqrt(std::log(static_cast<double>(current.visits) + 1.0)));
+        int best = current.firstChild;
+        float bestValue = -1.0f;
+        for (int c = 0; c < current.childCount; ++c) {
+            const Node& child = tree.nodes[current.firstChild + c];
+            if (child.visits == 0) {
+                best = current.firstChild + c;
+                break;
+            }
+            float inv = 1.0f / std::sqrt(static_cast<float>(child.visits));
+            float value = (child.wins * inv + explore) * inv;
+            if (value > bestValue) {
+                bestValue = value;
+                best = current.firstChild + c;
+            }
+        }
+
+        node = best;
+        char result = pb.play(pb.pad(tree.nodes[node].move), tree.nodes[node].player);
+        if (result != '*') {
+            tree.nodes[node].result = result;
+            outcome = result;
+            break;
+        }
+    }
+    if (!outcome)
+        outcome = rollout(tree, opponent(tree.nodes[node].player));
+
+    for (int n = node; n != -1; n = tree.nodes[n].parent) {
+        Node& visited = tree.nodes[n];
+        ++visited.visits;
+        if (outcome == visited.player)
+            visited.wins += 1.0f;
+        else if (outcome == 'D')
+            visited.wins += 0.5f;
+        if (n == tree.root)
+            break;
+    }
+    ++tree.simulations;
+}
+
+void Mcts::run(Tree& tree, const MctsLimits& limits, long long simulations, std::chrono::steady_clock::time_point start) {
+    for (long long n = 0; n < simulations || simulations == 0; ++n) {
+        if (limits.maxMillis > 0 && (n & 63) == 0) {
+            auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+            if (elapsed.count() >= limits.maxMillis)
+                break;
+        }
+        simulate(tree, limits.exploration);
+    }
+}
+
+MctsResult Mcts::search(const Board& board, int whoseMoveCounter, const MctsLimits& limits) {
+    auto start = std::chrono::steady_clock::now();
+    MctsResult result;
+    if (board.filledCells() >= board.width() * board.height())
+        return result;
+
+    int threads = std::max(1, limits.threads);
+    long long shape = (static_cast<long long>(board.width()) * 4096 + board.height()) * 4096 + board.winLength();
+    char justMoved = whoseMoveCounter % 2 == 0 ? 'O' : 'X';
+    uint64_t hash = board.hash();
+    bool reusable = shape == rootShape_ && static_cast<int>(trees_.size()) == threads;
+    if (!reusable) {
+        trees_.clear();
+        trees_.resize(threads);
+    }
+
+    for (int t = 0; t < threads; ++t) {
+        Tree& tree = trees_[t];
+        tree.rng.seed(limits.seed + 0x9E3779B97F4A7C15ULL * (t + 1));
+        if (!reusable || !reroot(tree, hash) || tree.nodes[tree.root].player != justMoved)
+            prepareTree(tree, justMoved);
+        result.reusedVisits += tree.nodes[tree.root].visits;
+        tree.start.load(board);
+        tree.simulations = 0;
+    }
+    rootHash_ = hash;
+    rootShape_ = shape;
+
+    long long perTree = 0;
+    if (limits.maxSimulations > 0)
+        perTree = (limits.maxSimulations + threads - 1) / threads;
+    else if (limits.maxMillis <= 0)
+        perTree = 10000;
+
+    if (threads == 1)
+        run(trees_[0], limits, perTree, start);
+    else {
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; ++t)
+            workers.emplace_back([this, t, &limits, perTree, start] { run(trees_[t], limits, perTree, start); });
+        for (auto& w : workers)
+            w.join();
+    }
+
+    int cells = board.width() * board.height();
+    std::vector<long long> visits(cells, 0);
+    std::vector<double> wins(cells, 0.0);
+    for (const Tree& tree : trees_) {
+        result.simulations += tree.simulations;
+        const Node& root = tree.nodes[tree.root];
+        for (int c = 0; root.expanded && c < root.childCount; ++c) {
+            const Node& child = tree.nodes[root.firstChild + c];
+            visits[child.move] += child.visits;
+            wins[child.move] += child.wins;
+        }
+    }
+
+    int best = -1;
+    for (int cell = 0; cell < cells; ++cell)
+        if (visits[cell] > 0 && (best < 0 || visits[cell] > visits[best]))
+            best = cell;
+    if (best >= 0) {
+        result.row = best / board.width();
+        result.col = best % board.width();
+        result.winRate = wins[best] / visits[best];
+    }
+
+    result.millis = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    if (result.millis > 0)
+        result.simulationsPerMs = result.simulations / result.millis;
+    return result;
+}
@@ -0,0 +1,88 @@
+#pragma once
+#include <vector>
+#include <random>
+#include <cstdint>
+#include <cstddef>
+#include <chrono>
+#include "../Board/Board.h"
+
+struct MctsLimits {
+    long long maxSimulations = 0;
+    int maxMillis = 0;
+    int threads = 1;
+    double exploration = 1.4;
+    uint64_t seed = 0;
+};
+
+struct MctsResult {
+    int row = -1;
+    int col = -1;
+    long long simulations = 0;
+    long long reusedVisits = 0;
+    double winRate = 0.0;
+    double millis = 0.0;
+    double simulationsPerMs = 0.0;
+};
+
+class Mcts {
+public:
+    explicit Mcts(size_t nodesPerTree = 1 << 18);
+
+    MctsResult search(const Board& board, int whoseMoveCounter, const MctsLimits& limits);
+    void clear();
+    size_t nodeCount() const;
+
+private:
+    struct Node {
+        int move;
+        int parent;
+        int firstChild;
+        int childCount;
+        int visits;
+        float wins;
+        char player;
+        char result;
+        bool expanded;
+    };
+
+    struct PlayoutBoard {
+        int width = 0;
+        int height = 0;
+        int k = 3;
+        int stride = 1;
+        int filled = 0;
+        std::vector<char> cells;
+        std::vector<int> empties;
+        std::vector<int> slot;
+
+        int pad(int cell) const { return (cell / width + 1) * stride + cell % width + 1; }
+        int unpad(int p) const { return (p / stride - 1) * width + p % stride - 1; }
+        void load(const Board& board);
+        char play(int cell, char player);
+        bool wins(int cell, char player) const;
+    };
+
+    struct Tree {
+        std::vector<Node> nodes;
+        int root = -1;
+        std::mt19937_64 rng;
+        PlayoutBoard start;
+        PlayoutBoard scratch;
+        std::vector<int> moves;
+        std::vector<char> near;
+        long long simulations = 0;
+    };
+
+    size_t capacity_;
+    std::vector<Tree> trees_;
+    uint64_t rootHash_;
+    long long rootShape_;
+
+    void prepareTree(Tree& tree, char justMoved);
+    bool reroot(Tree& tree, uint64_t target);
+    void compact(Tree& tree, int newRoot);
+    void expand(Tree& tree, int node, const PlayoutBoard& pb);
+    void simulate(Tree& tree, double exploration);
+    char rollout(Tree& tree, char toMove);
+    void run(Tree& tree, const MctsLimits& limits, long long simulations, std::chrono::steady_clock::time_point start);
+};
@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include "Mcts.h"
+
+TEST(MctsTest, TakesImmediateWin) {
+    Board b(3, 3);
+    int counter = 0;
+    b.place(counter, 0, 0);
+    b.place(counter, 1, 0);
+    b.place(counter, 0, 1);
+    b.place(counter, 1, 1);
+
+    Mcts mcts;
+    MctsLimits limits;
+    limits.maxSimulations = 2000;
+    MctsResult r = mcts.search(b, counter, limits);
+    EXPECT_EQ(r.row, 0);
+    EXPECT_EQ(r.col, 2);
+    EXPECT_GT(r.winRate, 0.9);
+}
+
+TEST(MctsTest, BlocksOpponentWin) {
+    Board b(3, 3);
+    int counter = 0;
+    b.place(counter, 0, 0);
+    b.place(counter, 1, 1);
+    b.place(counter, 0, 1);
+
+    Mcts mcts;
+    MctsLimits limits;
+    limits.maxSimulations = 5000;
+    MctsResult r = mcts.search(b, counter, limits);
+    EXPECT_EQ(r.row, 0);
+    EXPECT_EQ(r.col, 2);
+}
+
+TEST(MctsTest, CompletesFourOnLargeBoard) {
+    Board b(15, 15, '*', 5);
+    int counter = 0;
+    int moves[8][2] = { {7, 7}, {0, 0}, {7, 8}, {0, 14}, {7, 9}, {14, 14}, {7, 10}, {14, 0} };
+    for (auto& m : moves)
+        b.place(counter, m[0], m[1]);
+
+    Mcts mcts;
+    MctsLimits limits;
+    limits.maxSimulations = 3000;
+    limits.threads = 2;
+    MctsResult r = mcts.search(b, counter, limits);
+    EXPECT_EQ(r.row, 7);
+    EXPECT_TRUE(r.col == 6 || r.col == 11);
+    EXPECT_EQ(r.simulations, 3000);
+}
+
+TEST(MctsTest, ReusesTreeAfterTwoMoves) {
+    Board b(4, 4);
+    int counter = 0;
+    Mcts mcts;
+    MctsLimits limits;
+    limits.maxSimulations = 20000;
+    MctsResult first = mcts.search(b, counter, limits);
+    EXPECT_EQ(first.reusedVisits, 0);
+
+    b.place(counter, first.row, first.col);
+    int reply = first.row == 0 ? 3 : 0;
+    b.place(counter, reply, reply);
+    MctsResult second = mcts.search(b, counter, limits);
+    EXPECT_GT(second.reusedVisits, 0);
+    EXPECT_TRUE(b.checkCellAccess(second.row, second.col));
+}
+
+TEST(MctsTest, FixedSeedIsRepeatable) {
+    Board b(5, 5, '*', 4);
+    MctsLimits limits;
+    limits.maxSimulations = 3000;
+    limits.seed = 7;
+    Mcts a, c;
+    MctsResult ra = a.search(b, 0, limits);
+    MctsResult rc = c.search(b, 0, limits);
+    EXPECT_EQ(ra.row, rc.row);
+    EXPECT_EQ(ra.col, rc.col);
+    EXPECT_DOUBLE_EQ(ra.winRate, rc.winRate);
+}
+
+TEST(MctsTest, ArenaLimitStillReturnsMove) {
+    Board b(6, 6, '*', 4);
+    Mcts mcts(64);
+    MctsLimits limits;
+    limits.maxSimulations = 1000;
+    MctsResult r = mcts.search(b, 0, limits);
+    EXPECT_LE(mcts.nodeCount(), 64u);
+    EXPECT_TRUE(b.checkCellAccess(r.row, r.col));
+}
+
+TEST(MctsTest, FullBoardHasNoMove) {
+    Board b(1, 1);
+    int counter = 0;
+    b.place(counter, 0, 0);
+    Mcts mcts;
+    EXPECT_EQ(mcts.search(b, counter, MctsLimits()).row, -1);
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
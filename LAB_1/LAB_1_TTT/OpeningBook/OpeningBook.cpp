@@ -0,0 +1,317 @@
+#include "OpeningBook.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <unordered_set>
+#include "../Engine/Engine.h"
+#include "../Symmetry/Symmetry.h"
+
+static const char MAGIC[4] = { 'T', 'T', 'T', 'O' };
+
+static void putU64(uint8_t* p, uint64_t v) {
+    for (int b = 0; b < 8; ++b)
+        p[b] = static_cast<uint8_t>(v >> (8 * b));
+}
+
+static uint64_t getU64(const uint8_t* p) {
+    uint64_t v = 0;
+    for (int b = 0; b < 8; ++b)
+        v |= static_cast<uint64_t>(p[b]) << (8 * b);
+    return v;
+}
+
+static void putEntry(uint8_t* p, const BookEntry& e) {
+    putU64(p, e.key);
+    uint64_t low = static_cast<uint32_t>(e.move);
+    uint64_t high = static_cast<uint32_t>(e.score);
+    putU64(p + 8, low | (high << 32));
+}
+
+static BookEntry getEntry(const uint8_t* p) {
+    BookEntry e;
+    e.key = getU64(p);
+    uint64_t rest = getU64(p + 8);
+    e.move = static_cast<int32_t>(static_cast<uint32_t>(rest));
+    e.score = static_cast<int32_t>(static_cast<uint32_t>(rest >> 32));
+    return e;
+}
+
+static void makeHeader(uint8_t* header, int width, int height, int k, int plies, uint64_t count) {
+    std::memset(header, 0, OpeningBook::HEADER_SIZE);
+    std::memcpy(header, MAGIC, 4);
+    header[4] = 1;
+    header[5] = static_cast<uint8_t>(width);
+    header[6] = static_cast<uint8_t>(height);
+    header[7] = static_cast<uint8_t>(k);
+    header[8] = static_cast<uint8_t>(plies);
+    putU64(header + 16, count);
+}
+
+OpeningBook::OpeningBook() : width_(0), height_(0), k_(0), entries_(nullptr), count_(0) {}
+
+std::string OpeningBook::fileName(int width, int height, int k) {
+    return "book_" + std::to_string(width) + "x" + std::to_string(height) + "_" + std::to_string(k) + ".ttob";
+}
+
+uint64_t OpeningBook::key(const Board& board, int* t) {
+    if (Symmetry::supports(board.width(), board.height()))
+        return Symmetry::canonicalHash(board, t);
+    if (t)
+        *t = 0;
+    return board.hash();
+}
+
+std::vector<std::vector<int>> OpeningBook::positions(int width, int height, int k, int plies) {
+    std::vector<std::vector<int>> result(1);
+    std::unordered_set<uint64_t> seen;
+    Board empty(width, height, '*', k);
+    seen.insert(key(empty));
+
+    size_t layerBegin = 0;
+    for (int ply = 0; ply < plies; ++ply) {
+        size_t layerEnd = result.size();
+        for (size_t p = layerBegin; p < layerEnd; ++p) {
+            Board board(width, height, '*', k);
+            int counter = 0;
+            for (int cell : result[p])
+                board.place(counter, cell / width, cell % width);
+            for (int cell = 0; cell < width * height; ++cell) {
+                int i = cell / width, j = cell % width;
+                if (!board.checkCellAccess(i, j))
+                    continue;
+                char state = board.place(counter, i, j);
+                if (state == '*' && seen.insert(key(board)).second) {
+                    std::vector<int> line = result[p];
+                    line.push_back(cell);
+                    result.push_back(std::move(line));
+                }
+                board.unplace(counter, i, j);
+            }
+        }
+        layerBegin = layerEnd;
+    }
+    return result;
+}
+
+BookBuildResult OpeningBook::build(int width, int height, int k, const BookBuildOptions& options, const std::string& path) {
+    if (width < 1 || height < 1 || width > 255 || height > 255)
+        throw std::invalid_argument("     ");
+    if (k < 3) k = 3;
+    int plies = std::max(0, std::min(options.plies, width * height - 1));
+
+    BookBuildResult result;
+    std::vector<std::vector<int>> lines = positions(width, height, k, plies);
+    result.positions = static_cast<long long>(lines.size());
+
+    //     ,      
+    std::string journalPath = path + ".part";
+    uint8_t header[HEADER_SIZE];
+    makeHeader(header, width, height, k, plies, 0);
+    std::vector<BookEntry> entries;
+    {
+        std::ifstream in(journalPath, std::ios::binary);
+        uint8_t existing[HEADER_SIZE];
+        if (in.read(reinterpret_cast<char*>(existing), HEADER_SIZE) && std::memcmp(existing, header, HEADER_SIZE) == 0) {
+            uint8_t raw[ENTRY_SIZE];
+            while (in.read(reinterpret_cast<char*>(raw), ENTRY_SIZE))
+                entries.push_back(getEntry(raw));
+        }
+    }
+    result.resumed = static_cast<long long>(entries.size());
+
+    std::unordered_set<uint64_t> done;
+    for (const auto& e : entries)
+        done.insert(e.key);
+    std::vector<const std::vector<int>*> pending;
+    for (const auto& line : lines) {
+        Board board(width, height, '*', k);
+        int counter = 0;
+        for (int cell : line)
+            board.place(counter, cell / width, cell % width);
+        if (!done.count(key(board)))
+            pending.push_back(&line);
+    }
+    if (options.maxPositions > 0 && static_cast<long long>(pending.size()) > options.maxPositions)
+        pending.resize(static_cast<size_t>(options.maxPositions));
+    bool finishing = static_cast<long long>(entries.size() + pending.size()) >= result.positions;
+
+    //     :    
+    // ,        ENTRY_SIZE
+    std::ofstream journal(journalPath, std::ios::binary | std::ios::trunc);
+    journal.write(reinterpret_cast<const char*>(header), HEADER_SIZE);
+    for (const auto& e : entries) {
+        uint8_t raw[ENTRY_SIZE];
+        putEntry(raw, e);
+        journal.write(reinterpret_cast<const char*>(raw), ENTRY_SIZE);
+    }
+    journal.flush();
+    if (!journal)
+        throw std::runtime_error("   : " + journalPath);
+
+    std::mutex mutex;
+    std::atomic<size_t> next(0);
+    auto worker = [&]() {
+        Engine engine(8);
+        for (size_t p = next++; p < pending.size(); p = next++) {
+            Board board(width, height, '*', k);
+            int counter = 0;
+            for (int cell : *pending[p])
+                board.place(counter, cell / width, cell % width);
+
+            SearchLimits limits;
+            limits.maxDepth = options.searchDepth;
+            limits.maxMillis = options.millisPerPosition;
+            SearchResult found = engine.search(board, counter, limits);
+            if (found.row < 0)
+                continue;
+
+            BookEntry entry;
+            int t = 0;
+            entry.key = key(board, &t);
+            int i = found.row, j = found.col;
+            Symmetry::mapCell(t, width, height, i, j);
+            entry.move = i * width + j;
+            entry.score = found.score;
+
+            uint8_t raw[ENTRY_SIZE];
+            putEntry(raw, entry);
+            std::lock_guard<std::mutex> lock(mutex);
+            journal.write(reinterpret_cast<const char*>(raw), ENTRY_SIZE);
+            journal.flush();
+            entries.push_back(entry);
+            ++result.searched;
+        }
+    };
+
+    int threads = options.threads > 0 ? options.threads : static_cast<int>(std::thread::hardware_concurrency());
+    threads = std::max(1, std::min<int>(threads, static_cast<int>(std::max<size_t>(1, pending.size()))));
+    std::vector<std::thread> workers;
+    for (int t = 1; t < threads; ++t)
+        workers.emplace_back(worker);
+    worker();
+    for (auto& w : workers)
+        w.join();
+    journal.close();
+
+    if (!finishing)
+        return result;
+
+    std::sort(entries.begin(), entries.end(), [](const BookEntry& a, const BookEntry& b) { return a.key < b.key; });
+    entries.erase(std::unique(entries.begin(), entries.end(), [](const BookEntry& a, const BookEntry& b) { return a.key == b.key; }),
+        entries.end());
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out)
+        throw std::runtime_error("   : " + path);
+    makeHeader(header, width, height, k, plies, entries.size());
+    out.write(reinterpret_cast<const char*>(header), HEADER_SIZE);
+    for (const auto& e : entries) {
+        uint8_t raw[ENTRY_SIZE];
+        putEntry(raw, e);
+        out.write(reinterpret_cast<const char*>(raw), ENTRY_SIZE);
+    }
+    out.close();
+    if (!out)
+        throw std::runtime_error("  : " + path);
+    std::remove(journalPath.c_str());
+    result.complete = true;
+    return result;
+}
+
+void OpeningBook::open(const std::string& path) {
+    close();
+    file_.open(path);
+    const uint8_t* data = file_.data();
+    if (file_.size() < HEADER_SIZE || std::memcmp(data, MAGIC, 4) != 0 || data[4] != 1) {
+        file_.close();
+        throw std::runtime_error("   : " + path);
+    }
+    uint64_t count = getU64(data + 16);
+    if (file_.size() != HEADER_SIZE + count * ENTRY_SIZE) {
+        file_.close();
+        throw std::runtime_error("   : " + path);
+    }
+    width_ = data[5];
+    height_ = data[6];
+    k_ = data[7];
+    count_ = count;
+    entries_ = data + HEADER_SIZE;
+}
+
+void OpeningBook::close() {
+    file_.close();
+    entries_ = nullptr;
+    count_ = 0;
+}
+
+bool OpeningBook::isOpen() const {
+    return entries_ != nullptr && file_.isOpen();
+}
+
+bool OpeningBook::matches(const Board& board) const {
+    return isOpen() && board.width() == width_ && board.height() == height_ && board.winLength() == k_;
+}
+
+uint64_t OpeningBook::size() const {
+    return count_;
+}
+
+BookEntry OpeningBook::entryAt(uint64_t index) const {
+    return getEntry(entries_ + index * ENTRY_SIZE);
+}
+
+bool OpeningBook::find(uint64_t key, BookEntry& entry) const {
+    if (!isOpen() || count_ == 0)
+        return false;
+    //   ,     
+    //     - 
+    uint64_t low = 0, high = count_ - 1;
+    uint64_t lowKey = entryAt(low).key, highKey = entryAt(high).key;
+    while (key >= lowKey && key <= highKey) {
+        uint64_t pos = low;
+        if (highKey > lowKey)
+            pos += static_cast<uint64_t>(static_cast<double>(key - lowKey) / static_cast<double>(highKey - lowKey) * (high - low));
+        pos = std::min(pos, high);
+        BookEntry current = entryAt(pos);
+        if (current.key == key) {
+            entry = current;
+            return true;
+        }
+        if (current.key < key) {
+            if (pos == high)
+                return false;
+            low = pos + 1;
+            lowKey = entryAt(low).key;
+        }
+        else {
+            if (pos == low)
+                return false;
+            high = pos - 1;
+            highKey = entryAt(high).key;
+        }
+    }
+    return false;
+}
+
+bool OpeningBook::probe(const Board& board, int& row, int& col, int* score) const {
+    if (!matches(board))
+        return false;
+    int t = 0;
+    BookEntry entry;
+    if (!find(key(board, &t), entry) || entry.move < 0 || entry.move >= width_ * height_)
+        return false;
+    int i = entry.move / width_, j = entry.move % width_;
+    Symmetry::unmapCell(t, width_, height_, i, j);
+    if (!board.checkCellAccess(i, j))
+        return false;
+    row = i;
+    col = j;
+    if (score)
+        *score = entry.score;
+    return true;
+}
@@ -0,0 +1,58 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "../Board/Board.h"
+#include "../MappedFile/MappedFile.h"
+
+struct BookEntry {
+    uint64_t key = 0;
+    int move = -1;
+    int score = 0;
+};
+
+struct BookBuildOptions {
+    int plies = 4;
+    int searchDepth = 64;
+    int millisPerPosition = 200;
+    int threads = 0;
+    long long maxPositions = 0;
+};
+
+struct BookBuildResult {
+    long long positions = 0;
+    long long searched = 0;
+    long long resumed = 0;
+    bool complete = false;
+};
+
+class OpeningBook {
+public:
+    static constexpr int HEADER_SIZE = 32;
+    static constexpr int ENTRY_SIZE = 16;
+
+    OpeningBook();
+
+    static std::string fileName(int width, int height, int k);
+    static uint64_t key(const Board& board, int* t = nullptr);
+    static std::vector<std::vector<int>> positions(int width, int height, int k, int plies);
+    static BookBuildResult build(int width, int height, int k, const BookBuildOptions& options, const std::string& path);
+
+    void open(const std::string& path);
+    void close();
+    bool isOpen() const;
+    bool matches(const Board& board) const;
+    uint64_t size() const;
+    bool find(uint64_t key, BookEntry& entry) const;
+    bool probe(const Board& board, int& row, int& col, int* score = nullptr) const;
+
+private:
+    MappedFile file_;
+    int width_;
+    int height_;
+    int k_;
+    const uint8_t* entries_;
+    uint64_t count_;
+
+    BookEntry entryAt(uint64_t index) const;
+};
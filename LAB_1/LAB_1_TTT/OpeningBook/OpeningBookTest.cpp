@@ -0,0 +1,176 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include "OpeningBook.h"
+#include "../Engine/Engine.h"
+#include "../Tablebase/Tablebase.h"
+
+static BookBuildOptions options(int plies) {
+    BookBuildOptions o;
+    o.plies = plies;
+    o.searchDepth = 9;
+    o.millisPerPosition = 0;
+    o.threads = 2;
+    return o;
+}
+
+static int tbValue(const Tablebase& tb, const Board& b) {
+    TbEntry e = tb.probe(b);
+    return e.result == TbResult::Win ? 1 : e.result == TbResult::Loss ? -1 : 0;
+}
+
+TEST(OpeningBookTest, PositionsAreDeduplicatedBySymmetry) {
+    EXPECT_EQ(OpeningBook::positions(3, 3, 3, 0).size(), 1u);
+    EXPECT_EQ(OpeningBook::positions(3, 3, 3, 1).size(), 4u);
+    EXPECT_EQ(OpeningBook::positions(3, 3, 3, 2).size(), 16u);
+    EXPECT_EQ(OpeningBook::positions(4, 3, 3, 1).size(), 1u + 4u);
+}
+
+TEST(OpeningBookTest, BookMovesKeepTablebaseValue) {
+    const char* path = "book_test.ttob";
+    BookBuildResult built = OpeningBook::build(3, 3, 3, options(3), path);
+    EXPECT_TRUE(built.complete);
+    EXPECT_EQ(built.searched, built.positions);
+
+    const char* tbPath = "book_test.ttb";
+    Tablebase::generate(3, 3, 3, tbPath);
+    Tablebase tb;
+    tb.open(tbPath);
+
+    OpeningBook book;
+    book.open(path);
+    EXPECT_EQ(book.size(), static_cast<uint64_t>(built.positions));
+
+    for (const auto& line : OpeningBook::positions(3, 3, 3, 3)) {
+        Board b(3, 3);
+        int counter = 0;
+        for (int cell : line)
+            b.place(counter, cell / 3, cell % 3);
+        int row = -1, col = -1;
+        ASSERT_TRUE(book.probe(b, row, col));
+        int before = tbValue(tb, b);
+        char state = b.place(counter, row, col);
+        int after = state == 'X' || state == 'O' ? 1 : -tbValue(tb, b);
+        EXPECT_EQ(after, before);
+    }
+
+    Board rotated(3, 3);
+    int counter = 0;
+    rotated.place(counter, 2, 2);
+    int row = -1, col = -1;
+    ASSERT_TRUE(book.probe(rotated, row, col));
+    EXPECT_TRUE(rotated.checkCellAccess(row, col));
+    EXPECT_FALSE(book.probe(Board(4, 4), row, col));
+    book.close();
+    std::remove(path);
+    std::remove(tbPath);
+}
+
+TEST(OpeningBookTest, InterruptedBuildResumes) {
+    const char* path = "book_resume.ttob";
+    std::remove(path);
+    std::remove((std::string(path) + ".part").c_str());
+    BookBuildOptions o = options(2);
+    o.maxPositions = 5;
+    BookBuildResult first = OpeningBook::build(3, 3, 3, o, path);
+    EXPECT_FALSE(first.complete);
+    EXPECT_EQ(first.searched, 5);
+    EXPECT_FALSE(std::ifstream(path).good());
+
+    o.maxPositions = 0;
+    BookBuildResult second = OpeningBook::build(3, 3, 3, o, path);
+    EXPECT_TRUE(second.complete);
+    EXPECT_EQ(second.resumed, 5);
+    EXPECT_EQ(second.searched, second.positions - 5);
+    EXPECT_FALSE(std::ifstream(std::string(path) + ".part").good());
+
+    OpeningBook book;
+    book.open(path);
+    EXPECT_EQ(book.size(), 16u);
+    book.close();
+    std::remove(path);
+}
+
+TEST(OpeningBookTest, ResumeDropsTornJournalRecord) {
+    const char* path = "book_torn.ttob";
+    std::string part = std::string(path) + ".part";
+    std::remove(path);
+    std::remove(part.c_str());
+    BookBuildOptions o = options(2);
+    o.maxPositions = 5;
+    OpeningBook::build(3, 3, 3, o, path);
+
+    std::string bytes;
+    {
+        std::ifstream in(part, std::ios::binary);
+        bytes.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+    ASSERT_EQ(bytes.size(), static_cast<size_t>(OpeningBook::HEADER_SIZE + 5 * OpeningBook::ENTRY_SIZE));
+    bytes.resize(bytes.size() - 5);
+    std::ofstream(part, std::ios::binary | std::ios::trunc).write(bytes.data(), bytes.size());
+
+    o.maxPositions = 3;
+    BookBuildResult second = OpeningBook::build(3, 3, 3, o, path);
+    EXPECT_EQ(second.resumed, 4);
+    EXPECT_EQ(second.searched, 3);
+
+    o.maxPositions = 0;
+    BookBuildResult third = OpeningBook::build(3, 3, 3, o, path);
+    EXPECT_TRUE(third.complete);
+    EXPECT_EQ(third.resumed, 7);
+    EXPECT_EQ(third.searched, third.positions - 7);
+
+    OpeningBook book;
+    book.open(path);
+    EXPECT_EQ(book.size(), 16u);
+    int row = -1, col = -1;
+    Board b(3, 3);
+    ASSERT_TRUE(book.probe(b, row, col));
+    EXPECT_TRUE(b.checkCellAccess(row, col));
+    book.close();
+    std::remove(path);
+}
+
+TEST(OpeningBookTest, EngineAnswersFromBook) {
+    const char* path = "book_engine.ttob";
+    OpeningBook::build(4, 4, 3, options(1), path);
+    OpeningBook book;
+    book.open(path);
+
+    Engine engine;
+    engine.setBook(&book);
+    Board b(4, 4);
+    SearchLimits limits;
+    limits.maxDepth = 4;
+    SearchResult result = engine.search(b, 0, limits);
+    EXPECT_EQ(result.nodes, 0);
+    EXPECT_TRUE(b.checkCellAccess(result.row, result.col));
+    ASSERT_EQ(result.pv.size(), 1u);
+
+    int counter = 0;
+    b.place(counter, 0, 0);
+    b.place(counter, 3, 3);
+    result = engine.search(b, counter, limits);
+    EXPECT_GT(result.nodes, 0);
+    book.close();
+    std::remove(path);
+}
+
+TEST(OpeningBookTest, RejectsBadFile) {
+    const char* path = "book_bad.ttob";
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << "not a book";
+    }
+    OpeningBook book;
+    EXPECT_THROW(book.open(path), std::runtime_error);
+    EXPECT_FALSE(book.isOpen());
+    std::remove(path);
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
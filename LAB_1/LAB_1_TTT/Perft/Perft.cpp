@@ -0,0 +1,182 @@
+#include "Perft.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include "../Board/BitBoard.h"
+
+PerftCounts& PerftCounts::operator+=(const PerftCounts& other) {
+    nodes += other.nodes;
+    xWins += other.xWins;
+    oWins += other.oWins;
+    draws += other.draws;
+    return *this;
+}
+
+Perft::Perft(int width, int height, int k) : width_(width), height_(height), k_(k < 3 ? 3 : k) {
+    if (width < 1 || height < 1) throw std::invalid_argument("       ");
+}
+
+PerftCounts Perft::count(Board& board, int& whoseMoveCounter, int depth) const {
+    return walk(board, whoseMoveCounter, depth, nullptr);
+}
+
+template <typename B>
+PerftCounts Perft::walk(B& board, int& counter, int depth, std::vector<Entry>* table) const {
+    PerftCounts counts;
+    counts.nodes = 1;
+    if (depth == 0)
+        return counts;
+
+    //         
+    Entry* slot = nullptr;
+    uint64_t key = 0;
+    if (table) {
+        key = board.hash() ^ (static_cast<uint64_t>(depth) * 0x9E3779B97F4A7C15ULL) ^ 1;
+        slot = &(*table)[key & (table->size() - 1)];
+        if (slot->key == key)
+            return slot->counts;
+    }
+
+    for (int i = 0; i < height_; ++i)
+        for (int j = 0; j < width_; ++j) {
+            if (!board.checkCellAccess(i, j))
+                continue;
+            char state = board.place(counter, i, j);
+            if (state == '*')
+                counts += walk(board, counter, depth - 1, table);
+            else {
+                ++counts.nodes;
+                if (state == 'X')
+                    ++counts.xWins;
+                else if (state == 'O')
+                    ++counts.oWins;
+                else
+                    ++counts.draws;
+            }
+            board.unplace(counter, i, j);
+        }
+
+    if (slot) {
+        slot->key = key;
+        slot->counts = counts;
+    }
+    return counts;
+}
+
+PerftResult Perft::run(const PerftOptions& options) const {
+    auto start = std::chrono::steady_clock::now();
+    int cells = width_ * height_;
+    int depth = options.depth < 0 || options.depth > cells ? cells : options.depth;
+    int threads = options.threads > 0 ? options.threads : static_cast<int>(std::thread::hardware_concurrency());
+    threads = std::max(1, threads);
+
+    PerftResult result;
+    result.depth = depth;
+    result.threads = threads;
+
+    //    ,        
+    std::vector<std::vector<int>> tasks(1);
+    int splitDepth = 0;
+    while (splitDepth < depth && static_cast<int>(tasks.size()) < threads * 8) {
+        std::vector<std::vector<int>> next;
+        for (const auto& line : tasks) {
+            Board board(width_, height_, '*', k_);
+            int counter = 0;
+            for (int cell : line)
+                board.place(counter, cell / width_, cell % width_);
+            ++result.counts.nodes;
+            for (int cell = 0; cell < cells; ++cell) {
+                int i = cell / width_, j = cell % width_;
+                if (!board.checkCellAccess(i, j))
+                    continue;
+                char state = board.place(counter, i, j);
+                if (state == '*') {
+                    std::vector<int> child = line;
+                    child.push_back(cell);
+                    next.push_back(std::move(child));
+                }
+                else {
+                    ++result.counts.nodes;
+                    if (state == 'X')
+                        ++result.counts.xWins;
+                    else if (state == 'O')
+                        ++result.counts.oWins;
+                    else
+                        ++result.counts.draws;
+                }
+                board.unplace(counter, i, j);
+            }
+        }
+        tasks.swap(next);
+        ++splitDepth;
+    }
+
+    size_t tableSize = 0;
+    if (options.hashMegabytes > 0) {
+        tableSize = 1;
+        while (tableSize * 2 * sizeof(Entry) <= options.hashMegabytes * 1024 * 1024)
+            tableSize *= 2;
+    }
+
+    std::mutex mutex;
+    std::atomic<size_t> next(0);
+    auto drain = [&](auto& board, std::vector<Entry>* table, PerftCounts& local) {
+        for (size_t t = next++; t < tasks.size(); t = next++) {
+            int counter = 0;
+            for (int cell : tasks[t])
+                board.place(counter, cell / width_, cell % width_);
+            local += walk(board, counter, depth - splitDepth, table);
+            for (size_t m = tasks[t].size(); m-- > 0;)
+                board.unplace(counter, tasks[t][m] / width_, tasks[t][m] % width_);
+        }
+    };
+    auto worker = [&]() {
+        std::vector<Entry> table(tableSize, Entry{ 0, PerftCounts() });
+        std::vector<Entry>* hashed = tableSize ? &table : nullptr;
+        PerftCounts local;
+        //     BitBoard: ,        
+        if (width_ == 3 && height_ == 3) {
+            BitBoard<3, 3> board('*', k_);
+            drain(board, hashed, local);
+        }
+        else if (width_ == 4 && height_ == 4) {
+            BitBoard<4, 4> board('*', k_);
+            drain(board, hashed, local);
+        }
+        else {
+            Board board(width_, height_, '*', k_);
+            drain(board, hashed, local);
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        result.counts += local;
+    };
+
+    std::vector<std::thread> workers;
+    for (int t = 1; t < threads; ++t)
+        workers.emplace_back(worker);
+    worker();
+    for (auto& w : workers)
+        w.join();
+
+    result.millis = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    if (result.millis > 0)
+        result.nodesPerSecond = result.counts.nodes * 1000.0 / result.millis;
+    return result;
+}
+
+std::string Perft::report(const PerftResult& result) const {
+    std::ostringstream out;
+    out << "perft " << width_ << "x" << height_ << ", k=" << k_ << ",  " << result.depth
+        << ",  " << result.threads << "\n"
+        << ": " << result.counts.nodes << "  : " << result.counts.games()
+        << " (X " << result.counts.xWins << ", O " << result.counts.oWins << ",  " << result.counts.draws << ")\n"
+        << std::fixed << std::setprecision(1)
+        << ": " << result.millis << " , " << std::setprecision(0) << result.nodesPerSecond << " /\n";
+    return out.str();
+}
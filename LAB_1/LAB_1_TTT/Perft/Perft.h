@@ -0,0 +1,51 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "../Board/Board.h"
+
+struct PerftCounts {
+    long long nodes = 0;
+    long long xWins = 0;
+    long long oWins = 0;
+    long long draws = 0;
+
+    long long games() const { return xWins + oWins + draws; }
+    PerftCounts& operator+=(const PerftCounts& other);
+};
+
+struct PerftOptions {
+    int depth = -1;
+    int threads = 0;
+    size_t hashMegabytes = 0;
+};
+
+struct PerftResult {
+    PerftCounts counts;
+    int depth = 0;
+    int threads = 1;
+    double millis = 0.0;
+    double nodesPerSecond = 0.0;
+};
+
+class Perft {
+public:
+    Perft(int width = 3, int height = 3, int k = 3);
+
+    PerftResult run(const PerftOptions& options) const;
+    PerftCounts count(Board& board, int& whoseMoveCounter, int depth) const;
+    std::string report(const PerftResult& result) const;
+
+private:
+    struct Entry {
+        uint64_t key;
+        PerftCounts counts;
+    };
+
+    int width_;
+    int height_;
+    int k_;
+
+    template <typename B>
+    PerftCounts walk(B& board, int& counter, int depth, std::vector<Entry>* table) const;
+};
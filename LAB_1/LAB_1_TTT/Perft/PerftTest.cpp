@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+#include "Perft.h"
+
+static void expectFullThreeByThree(const PerftCounts& c) {
+    EXPECT_EQ(c.games(), 255168);
+    EXPECT_EQ(c.xWins, 131184);
+    EXPECT_EQ(c.oWins, 77904);
+    EXPECT_EQ(c.draws, 46080);
+    EXPECT_EQ(c.nodes, 549946);
+}
+
+TEST(PerftTest, SerialThreeByThreeTotals) {
+    Board b(3, 3);
+    int counter = 0;
+    expectFullThreeByThree(Perft().count(b, counter, 9));
+    EXPECT_EQ(counter, 0);
+    EXPECT_EQ(b.filledCells(), 0);
+}
+
+TEST(PerftTest, ParallelAndHashedTotalsMatch) {
+    Perft perft;
+    PerftOptions options;
+    options.threads = 4;
+    PerftResult plain = perft.run(options);
+    expectFullThreeByThree(plain.counts);
+    EXPECT_EQ(plain.depth, 9);
+    EXPECT_GT(plain.nodesPerSecond, 0.0);
+
+    options.hashMegabytes = 4;
+    expectFullThreeByThree(perft.run(options).counts);
+}
+
+TEST(PerftTest, BitBoardWalkMatchesBoard) {
+    Board b(4, 4);
+    int counter = 0;
+    PerftCounts serial = Perft(4, 4, 3).count(b, counter, 5);
+
+    PerftOptions options;
+    options.depth = 5;
+    options.threads = 1;
+    PerftCounts bits = Perft(4, 4, 3).run(options).counts;
+    EXPECT_EQ(bits.nodes, serial.nodes);
+    EXPECT_EQ(bits.xWins, serial.xWins);
+    EXPECT_EQ(bits.oWins, serial.oWins);
+    EXPECT_EQ(bits.draws, serial.draws);
+}
+
+TEST(PerftTest, DepthLimitedCounts) {
+    Perft perft;
+    PerftOptions options;
+    options.threads = 2;
+    options.depth = 2;
+    PerftResult r = perft.run(options);
+    EXPECT_EQ(r.counts.nodes, 1 + 9 + 72);
+    EXPECT_EQ(r.counts.games(), 0);
+
+    options.depth = 5;
+    r = perft.run(options);
+    EXPECT_EQ(r.counts.nodes, 1 + 9 + 72 + 504 + 3024 + 15120);
+    EXPECT_EQ(r.counts.xWins, 1440);
+}
+
+TEST(PerftTest, HashingAgreesOnLargerBoard) {
+    Perft perft(4, 4, 3);
+    PerftOptions options;
+    options.depth = 5;
+    options.threads = 3;
+    PerftCounts plain = perft.run(options).counts;
+    options.hashMegabytes = 8;
+    PerftCounts hashed = perft.run(options).counts;
+    EXPECT_EQ(plain.nodes, hashed.nodes);
+    EXPECT_EQ(plain.xWins, hashed.xWins);
+    EXPECT_EQ(plain.oWins, hashed.oWins);
+    EXPECT_EQ(plain.draws, hashed.draws);
+    EXPECT_GT(plain.xWins, 0);
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,114 @@
+#include "Symmetry.h"
+#include <utility>
+
+bool Symmetry::supports(int width, int height) {
+    return width >= 1 && height >= 1 && width <= 8 && height <= 8;
+}
+
+int Symmetry::transformCount(int width, int height) {
+    return width == height ? 8 : 4;
+}
+
+uint64_t Symmetry::flipVertical(uint64_t bits) {
+    bits = ((bits >> 8) & 0x00FF00FF00FF00FFULL) | ((bits & 0x00FF00FF00FF00FFULL) << 8);
+    bits = ((bits >> 16) & 0x0000FFFF0000FFFFULL) | ((bits & 0x0000FFFF0000FFFFULL) << 16);
+    return (bits >> 32) | (bits << 32);
+}
+
+uint64_t Symmetry::mirrorHorizontal(uint64_t bits) {
+    bits = ((bits >> 1) & 0x5555555555555555ULL) | ((bits & 0x5555555555555555ULL) << 1);
+    bits = ((bits >> 2) & 0x3333333333333333ULL) | ((bits & 0x3333333333333333ULL) << 2);
+    return ((bits >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((bits & 0x0F0F0F0F0F0F0F0FULL) << 4);
+}
+
+uint64_t Symmetry::transpose(uint64_t bits) {
+    uint64_t t;
+    t = 0x0F0F0F0F00000000ULL & (bits ^ (bits << 28));
+    bits ^= t ^ (t >> 28);
+    t = 0x3333000033330000ULL & (bits ^ (bits << 14));
+    bits ^= t ^ (t >> 14);
+    t = 0x5500550055005500ULL & (bits ^ (bits << 7));
+    bits ^= t ^ (t >> 7);
+    return bits;
+}
+
+PackedPosition Symmetry::pack(const Board& board) {
+    if (!supports(board.width(), board.height())) throw std::invalid_argument("      64 ");
+    PackedPosition p;
+    for (int i = 0; i < board.height(); ++i)
+        for (int j = 0; j < board.width(); ++j) {
+            char c = board.at(i, j);
+            if (c == 'X')
+                p.x |= 1ULL << (i * 8 + j);
+            else if (c == 'O')
+                p.o |= 1ULL << (i * 8 + j);
+        }
+    return p;
+}
+
+static uint64_t transformBits(uint64_t bits, int t, int width, int height) {
+    if (t & 1)
+        bits = Symmetry::flipVertical(bits) >> (8 * (8 - height));
+    if (t & 2)
+        bits = Symmetry::mirrorHorizontal(bits) >> (8 - width);
+    if (t & 4)
+        bits = Symmetry::transpose(bits);
+    return bits;
+}
+
+PackedPosition Symmetry::transform(const PackedPosition& position, int t, int width, int height) {
+    PackedPosition p;
+    p.x = transformBits(position.x, t, width, height);
+    p.o = transformBits(position.o, t, width, height);
+    return p;
+}
+
+int Symmetry::canonicalTransform(const Board& board, PackedPosition* canonical) {
+    PackedPosition original = pack(board);
+    PackedPosition best = original;
+    int bestT = 0;
+    int count = transformCount(board.width(), board.height());
+    for (int t = 1; t < count; ++t) {
+        PackedPosition p = transform(original, t, board.width(), board.height());
+        if (p < best) {
+            best = p;
+            bestT = t;
+        }
+    }
+    if (canonical)
+        *canonical = best;
+    return bestT;
+}
+
+static uint64_t mix(uint64_t z) {
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+uint64_t Symmetry::canonicalHash(const Board& board, int* t) {
+    PackedPosition canonical;
+    int bestT = canonicalTransform(board, &canonical);
+    if (t)
+        *t = bestT;
+    uint64_t o = mix(canonical.o + 0x9E3779B97F4A7C15ULL);
+    return mix(canonical.x) ^ ((o << 17) | (o >> 47));
+}
+
+void Symmetry::mapCell(int t, int width, int height, int& i, int& j) {
+    if (t & 1)
+        i = height - 1 - i;
+    if (t & 2)
+        j = width - 1 - j;
+    if (t & 4)
+        std::swap(i, j);
+}
+
+void Symmetry::unmapCell(int t, int width, int height, int& i, int& j) {
+    if (t & 4)
+        std::swap(i, j);
+    if (t & 2)
+        j = width - 1 - j;
+    if (t & 1)
+        i = height - 1 - i;
+}
@@ -0,0 +1,29 @@
+#pragma once
+#include <cstdint>
+#include "../Board/Board.h"
+
+struct PackedPosition {
+    uint64_t x = 0;
+    uint64_t o = 0;
+
+    bool operator==(const PackedPosition& other) const { return x == other.x && o == other.o; }
+    bool operator<(const PackedPosition& other) const { return x < other.x || (x == other.x && o < other.o); }
+};
+
+class Symmetry {
+public:
+    static bool supports(int width, int height);
+    static int transformCount(int width, int height);
+
+    static PackedPosition pack(const Board& board);
+    static PackedPosition transform(const PackedPosition& position, int t, int width, int height);
+    static int canonicalTransform(const Board& board, PackedPosition* canonical = nullptr);
+    static uint64_t canonicalHash(const Board& board, int* t = nullptr);
+
+    static void mapCell(int t, int width, int height, int& i, int& j);
+    static void unmapCell(int t, int width, int height, int& i, int& j);
+
+    static uint64_t flipVertical(uint64_t bits);
+    static uint64_t mirrorHorizontal(uint64_t bits);
+    static uint64_t transpose(uint64_t bits);
+};
@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+#include <random>
+#include "Symmetry.h"
+
+static Board randomBoard(int w, int h, unsigned seed) {
+    std::mt19937 rng(seed);
+    Board b(w, h);
+    int counter = 0;
+    for (int n = 0; n < w * h / 2; ++n) {
+        int i = rng() % h, j = rng() % w;
+        if (b.checkCellAccess(i, j))
+            b[i][j] = counter++ % 2 == 0 ? 'X' : 'O';
+    }
+    return b;
+}
+
+static Board transformNaive(const Board& b, int t) {
+    int w = b.width(), h = b.height();
+    Board out(t & 4 ? h : w, t & 4 ? w : h);
+    for (int i = 0; i < h; ++i)
+        for (int j = 0; j < w; ++j) {
+            int ti = i, tj = j;
+            Symmetry::mapCell(t, w, h, ti, tj);
+            out[ti][tj] = b.at(i, j);
+        }
+    return out;
+}
+
+TEST(SymmetryTest, BitTricksMatchNaiveTransforms) {
+    int sizes[4][2] = { {3, 3}, {4, 4}, {8, 8}, {5, 3} };
+    for (auto& s : sizes)
+        for (unsigned seed = 1; seed < 20; ++seed) {
+            Board b = randomBoard(s[0], s[1], seed);
+            PackedPosition packed = Symmetry::pack(b);
+            for (int t = 0; t < Symmetry::transformCount(s[0], s[1]); ++t)
+                EXPECT_EQ(Symmetry::transform(packed, t, s[0], s[1]), Symmetry::pack(transformNaive(b, t)));
+        }
+}
+
+TEST(SymmetryTest, SymmetricBoardsShareCanonicalHash) {
+    for (unsigned seed = 1; seed < 20; ++seed) {
+        Board b = randomBoard(4, 4, seed);
+        uint64_t hash = Symmetry::canonicalHash(b);
+        for (int t = 1; t < 8; ++t)
+            EXPECT_EQ(Symmetry::canonicalHash(transformNaive(b, t)), hash);
+    }
+    Board rect = randomBoard(5, 3, 7);
+    for (int t = 1; t < 4; ++t)
+        EXPECT_EQ(Symmetry::canonicalHash(transformNaive(rect, t)), Symmetry::canonicalHash(rect));
+}
+
+TEST(SymmetryTest, MoveTransformsBack) {
+    Board b(3, 3);
+    b[0][1] = 'X';
+    int t;
+    Symmetry::canonicalHash(b, &t);
+    PackedPosition canonical;
+    Symmetry::canonicalTransform(b, &canonical);
+
+    for (int i = 0; i < 3; ++i)
+        for (int j = 0; j < 3; ++j) {
+            int ci = i, cj = j;
+            Symmetry::mapCell(t, 3, 3, ci, cj);
+            Symmetry::unmapCell(t, 3, 3, ci, cj);
+            EXPECT_EQ(ci, i);
+            EXPECT_EQ(cj, j);
+        }
+    int i = 0, j = 1;
+    Symmetry::mapCell(t, 3, 3, i, j);
+    EXPECT_TRUE(canonical.x & (1ULL << (i * 8 + j)));
+}
+
+TEST(SymmetryTest, CornerOpeningsCollapse) {
+    Board corners[4] = { Board(3, 3), Board(3, 3), Board(3, 3), Board(3, 3) };
+    corners[0][0][0] = 'X';
+    corners[1][0][2] = 'X';
+    corners[2][2][0] = 'X';
+    corners[3][2][2] = 'X';
+    for (auto& b : corners)
+        EXPECT_EQ(Symmetry::canonicalHash(b), Symmetry::canonicalHash(corners[0]));
+    Board centre(3, 3);
+    centre[1][1] = 'X';
+    EXPECT_NE(Symmetry::canonicalHash(centre), Symmetry::canonicalHash(corners[0]));
+}
+
+TEST(SymmetryTest, RejectsLargeBoards) {
+    EXPECT_FALSE(Symmetry::supports(9, 9));
+    EXPECT_THROW(Symmetry::pack(Board(9, 3)), std::invalid_argument);
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
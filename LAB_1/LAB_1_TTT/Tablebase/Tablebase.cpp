@@ -0,0 +1,220 @@
+#include "Tablebase.h"
+#include <fstream>
+#include <cstring>
+#include <stdexcept>
+
+static const char MAGIC[4] = { 'T', 'T', 'T', 'B' };
+
+static std::vector<std::vector<int>> winLines(int width, int height, int k) {
+    static const int dirs[4][2] = { {0, 1}, {1, 0}, {1, 1}, {1, -1} };
+    std::vector<std::vector<int>> lines;
+    for (auto& d : dirs)
+        for (int i = 0; i < height; ++i)
+            for (int j = 0; j < width; ++j) {
+                int ei = i + d[0] * (k - 1), ej = j + d[1] * (k - 1);
+                if (ei < 0 || ei >= height || ej < 0 || ej >= width)
+                    continue;
+                std::vector<int> line;
+                for (int s = 0; s < k; ++s)
+                    line.push_back((i + d[0] * s) * width + (j + d[1] * s));
+                lines.push_back(line);
+            }
+    return lines;
+}
+
+Tablebase::Tablebase() : width_(0), height_(0), k_(0), table_(nullptr), size_(0) {}
+
+bool Tablebase::supports(int width, int height) {
+    return width >= 1 && height >= 1 && width * height <= MAX_CELLS;
+}
+
+std::string Tablebase::fileName(int width, int height, int k) {
+    return "tb_" + std::to_string(width) + "x" + std::to_string(height) + "_" + std::to_string(k) + ".ttb";
+}
+
+uint8_t Tablebase::encode(TbResult result, int distance) {
+    return static_cast<uint8_t>((static_cast<int>(result) << 6) | (distance & 63));
+}
+
+TbEntry Tablebase::decode(uint8_t value) {
+    TbEntry entry;
+    entry.result = static_cast<TbResult>(value >> 6);
+    entry.distance = value & 63;
+    return entry;
+}
+
+std::vector<uint8_t> Tablebase::solve(int width, int height, int k) {
+    if (!supports(width, height)) throw std::invalid_argument("     ");
+    if (k < 3) k = 3;
+
+    int cells = width * height;
+    std::vector<uint64_t> pow3(cells + 1, 1);
+    for (int c = 1; c <= cells; ++c)
+        pow3[c] = pow3[c - 1] * 3;
+    std::vector<std::vector<int>> lines = winLines(width, height, k);
+    std::vector<uint8_t> table(pow3[cells], 0);
+    std::vector<int> digits(cells);
+
+    //    ,      :
+    //           
+    for (uint64_t index = pow3[cells]; index-- > 0;) {
+        uint64_t rest = index;
+        int xs = 0, os = 0;
+        for (int c = 0; c < cells; ++c) {
+            digits[c] = static_cast<int>(rest % 3);
+            rest /= 3;
+            xs += digits[c] == 1;
+            os += digits[c] == 2;
+        }
+        if (xs != os && xs != os + 1)
+            continue;
+
+        bool xLine = false, oLine = false;
+        for (const auto& line : lines) {
+            int first = digits[line[0]];
+            if (first == 0)
+                continue;
+            bool full = true;
+            for (int cell : line)
+                if (digits[cell] != first) {
+                    full = false;
+                    break;
+                }
+            if (full)
+                (first == 1 ? xLine : oLine) = true;
+        }
+
+        int toMove = xs == os ? 1 : 2;
+        bool moverHasLine = toMove == 1 ? xLine : oLine;
+        bool lastHasLine = toMove == 1 ? oLine : xLine;
+        if (moverHasLine)
+            continue;
+        if (lastHasLine) {
+            table[index] = encode(TbResult::Loss, 0);
+            continue;
+        }
+        if (xs + os == cells) {
+            table[index] = encode(TbResult::Draw, 0);
+            continue;
+        }
+
+        int bestWin = -1, worstLoss = -1;
+        bool draw = false;
+        for (int c = 0; c < cells; ++c) {
+            if (digits[c] != 0)
+                continue;
+            TbEntry child = decode(table[index + pow3[c] * toMove]);
+            if (child.result == TbResult::Loss && (bestWin < 0 || child.distance + 1 < bestWin))
+                bestWin = child.distance + 1;
+            else if (child.result == TbResult::Draw)
+                draw = true;
+            else if (child.result == TbResult::Win && child.distance + 1 > worstLoss)
+                worstLoss = child.distance + 1;
+        }
+        if (bestWin >= 0)
+            table[index] = encode(TbResult::Win, bestWin);
+        else if (draw)
+            table[index] = encode(TbResult::Draw, 0);
+        else
+            table[index] = encode(TbResult::Loss, worstLoss);
+    }
+    return table;
+}
+
+void Tablebase::generate(int width, int height, int k, const std::string& path) {
+    std::vector<uint8_t> table = solve(width, height, k);
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out)
+        throw std::runtime_error("   : " + path);
+
+    uint8_t header[HEADER_SIZE] = {};
+    std::memcpy(header, MAGIC, 4);
+    header[4] = 1;
+    header[5] = static_cast<uint8_t>(width);
+    header[6] = static_cast<uint8_t>(height);
+    header[7] = static_cast<uint8_t>(k < 3 ? 3 : k);
+    uint64_t size = table.size();
+    for (int b = 0; b < 8; ++b)
+        header[8 + b] = static_cast<uint8_t>(size >> (8 * b));
+    out.write(reinterpret_cast<const char*>(header), HEADER_SIZE);
+    out.write(reinterpret_cast<const char*>(table.data()), static_cast<std::streamsize>(table.size()));
+    if (!out)
+        throw std::runtime_error("  : " + path);
+}
+
+void Tablebase::open(const std::string& path) {
+    file_.open(path);
+    const uint8_t* data = file_.data();
+    if (file_.size() < HEADER_SIZE || std::memcmp(data, MAGIC, 4) != 0 || data[4] != 1) {
+        file_.close();
+        throw std::runtime_error("   : " + path);
+    }
+    width_ = data[5];
+    height_ = data[6];
+    k_ = data[7];
+    size_ = 0;
+    for (int b = 0; b < 8; ++b)
+        size_ |= static_cast<uint64_t>(data[8 + b]) << (8 * b);
+    if (!supports(width_, height_) || file_.size() != HEADER_SIZE + size_) {
+        file_.close();
+        throw std::runtime_error("   : " + path);
+    }
+    table_ = data + HEADER_SIZE;
+}
+
+bool Tablebase::isOpen() const {
+    return table_ != nullptr && file_.isOpen();
+}
+
+bool Tablebase::matches(const Board& board) const {
+    return isOpen() && board.width() == width_ && board.height() == height_ && board.winLength() == k_;
+}
+
+uint64_t Tablebase::index(const Board& board) const {
+    uint64_t index = 0;
+    for (int c = width_ * height_ - 1; c >= 0; --c) {
+        char symbol = board.at(c / width_, c % width_);
+        index = index * 3 + (symbol == 'X' ? 1 : (symbol == 'O' ? 2 : 0));
+    }
+    return index;
+}
+
+TbEntry Tablebase::probe(const Board& board) const {
+    if (!matches(board))
+        return TbEntry();
+    return decode(table_[index(board)]);
+}
+
+bool Tablebase::bestMove(const Board& board, int& row, int& col) const {
+    TbEntry here = probe(board);
+    if (here.result == TbResult::Illegal)
+        return false;
+
+    uint64_t base = index(board);
+    int toMove = board.filledCells() % 2 == 0 ? 1 : 2;
+    uint64_t weight = 1;
+    int best = -1, bestRank = 0;
+    for (int c = 0; c < width_ * height_; ++c, weight *= 3) {
+        if (board.at(c / width_, c % width_) == 'X' || board.at(c / width_, c % width_) == 'O')
+            continue;
+        TbEntry child = decode(table_[base + weight * toMove]);
+        int rank;
+        if (child.result == TbResult::Loss)
+            rank = 3000 - child.distance;
+        else if (child.result == TbResult::Draw)
+            rank = 2000;
+        else if (child.result == TbResult::Win)
+            rank = 1000 + child.distance;
+        else
+            continue;
+        if (best < 0 || rank > bestRank) {
+            best = c;
+            bestRank = rank;
+        }
+    }
+    if (best < 0)
+        return false;
+    row = best / width_;
+    col = best % width_;
+    return true;
+}
@@ -0,0 +1,44 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "../Board/Board.h"
+#include "../MappedFile/MappedFile.h"
+
+enum class TbResult : uint8_t { Illegal = 0, Draw = 1, Win = 2, Loss = 3 };
+
+struct TbEntry {
+    TbResult result = TbResult::Illegal;
+    int distance = 0;
+};
+
+class Tablebase {
+public:
+    static constexpr int MAX_CELLS = 16;
+    static constexpr int HEADER_SIZE = 16;
+
+    Tablebase();
+
+    static bool supports(int width, int height);
+    static std::string fileName(int width, int height, int k);
+    static std::vector<uint8_t> solve(int width, int height, int k);
+    static void generate(int width, int height, int k, const std::string& path);
+
+    void open(const std::string& path);
+    bool isOpen() const;
+    bool matches(const Board& board) const;
+    uint64_t index(const Board& board) const;
+    TbEntry probe(const Board& board) const;
+    bool bestMove(const Board& board, int& row, int& col) const;
+
+    static uint8_t encode(TbResult result, int distance);
+    static TbEntry decode(uint8_t value);
+
+private:
+    MappedFile file_;
+    int width_;
+    int height_;
+    int k_;
+    const uint8_t* table_;
+    uint64_t size_;
+};
@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include "Tablebase.h"
+
+TEST(TablebaseTest, ThreeByThreeHasAllLegalPositions) {
+    std::vector<uint8_t> table = Tablebase::solve(3, 3, 3);
+    ASSERT_EQ(table.size(), 19683u);
+    int legal = 0;
+    for (uint8_t value : table)
+        if (Tablebase::decode(value).result != TbResult::Illegal)
+            ++legal;
+    EXPECT_EQ(legal, 5478);
+    TbEntry empty = Tablebase::decode(table[0]);
+    EXPECT_EQ(empty.result, TbResult::Draw);
+}
+
+TEST(TablebaseTest, EncodeRoundTrip) {
+    TbEntry e = Tablebase::decode(Tablebase::encode(TbResult::Loss, 37));
+    EXPECT_EQ(e.result, TbResult::Loss);
+    EXPECT_EQ(e.distance, 37);
+}
+
+TEST(TablebaseTest, FileIsMappedAndProbed) {
+    std::string path = Tablebase::fileName(3, 3, 3);
+    Tablebase::generate(3, 3, 3, path);
+
+    Tablebase tb;
+    tb.open(path);
+    Board b(3, 3);
+    ASSERT_TRUE(tb.matches(b));
+    EXPECT_EQ(tb.probe(b).result, TbResult::Draw);
+
+    int counter = 0;
+    b.place(counter, 0, 0);
+    b.place(counter, 1, 0);
+    b.place(counter, 0, 1);
+    b.place(counter, 1, 1);
+    TbEntry entry = tb.probe(b);
+    EXPECT_EQ(entry.result, TbResult::Win);
+    EXPECT_EQ(entry.distance, 1);
+
+    int row = -1, col = -1;
+    ASSERT_TRUE(tb.bestMove(b, row, col));
+    EXPECT_EQ(row, 0);
+    EXPECT_EQ(col, 2);
+    b.place(counter, row, col);
+    EXPECT_EQ(tb.probe(b).result, TbResult::Loss);
+    EXPECT_FALSE(tb.bestMove(b, row, col));
+
+    EXPECT_FALSE(tb.matches(Board(4, 4)));
+    std::remove(path.c_str());
+}
+
+TEST(TablebaseTest, PerfectPlayDrawsItself) {
+    std::string path = Tablebase::fileName(4, 3, 3);
+    Tablebase::generate(4, 3, 3, path);
+    Tablebase tb;
+    tb.open(path);
+
+    Board b(4, 3);
+    int counter = 0;
+    TbEntry start = tb.probe(b);
+    ASSERT_NE(start.result, TbResult::Illegal);
+    char result = '*';
+    int row, col;
+    while (result == '*' && tb.bestMove(b, row, col))
+        result = b.place(counter, row, col);
+    if (start.result == TbResult::Win) {
+        EXPECT_EQ(result, 'X');
+        EXPECT_EQ(counter, start.distance);
+    }
+    else {
+        EXPECT_EQ(result, 'D');
+    }
+    std::remove(path.c_str());
+}
+
+TEST(TablebaseTest, RejectsLargeBoardsAndBadFiles) {
+    EXPECT_THROW(Tablebase::solve(5, 5, 4), std::invalid_argument);
+    Tablebase tb;
+    EXPECT_THROW(tb.open("no_such_table.ttb"), std::runtime_error);
+    EXPECT_FALSE(tb.isOpen());
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,195 @@
+#include "Tournament.h"
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <iomanip>
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include "../Engine/Engine.h"
+#include "../Mcts/Mcts.h"
+
+class Tournament::Player {
+public:
+    explicit Player(const PlayerConfig& config) : config_(config), engine_(4) {}
+
+    void newGame(uint64_t seed) {
+        rng_.seed(seed);
+        seed_ = seed;
+        mcts_.clear();
+    }
+
+    bool chooseMove(Board& board, int counter, int& row, int& col) {
+        if (config_.kind == PlayerKind::Random)
+            return randomMove(board, rng_, row, col);
+
+        if (config_.kind == PlayerKind::Mcts) {
+            MctsLimits limits;
+            limits.maxMillis = config_.millisPerMove;
+            limits.maxSimulations = config_.simulations;
+            limits.seed = seed_ + counter;
+            MctsResult result = mcts_.search(board, counter, limits);
+            row = result.row;
+            col = result.col;
+            return row >= 0;
+        }
+
+        SearchLimits limits;
+        limits.maxMillis = config_.millisPerMove;
+        limits.maxDepth = config_.maxDepth;
+        limits.maxNodes = config_.maxNodes;
+        SearchResult result = engine_.search(board, counter, limits);
+        row = result.row;
+        col = result.col;
+        return row >= 0;
+    }
+
+    static bool randomMove(const Board& board, std::mt19937_64& rng, int& row, int& col) {
+        int empties = board.width() * board.height() - board.filledCells();
+        if (empties <= 0)
+            return false;
+        int pick = static_cast<int>(rng() % empties);
+        for (int i = 0; i < board.height(); ++i)
+            for (int j = 0; j < board.width(); ++j)
+                if (board.checkCellAccess(i, j) && pick-- == 0) {
+                    row = i;
+                    col = j;
+                    return true;
+                }
+        return false;
+    }
+
+private:
+    PlayerConfig config_;
+    Engine engine_;
+    Mcts mcts_;
+    std::mt19937_64 rng_;
+    uint64_t seed_ = 0;
+};
+
+Tournament::Tournament(const TournamentConfig& config, const PlayerConfig& first, const PlayerConfig& second)
+    : config_(config), first_(first), second_(second) {
+    if (config_.games < 1) throw std::invalid_argument("    ");
+}
+
+PlayerKind Tournament::parseKind(const std::string& name) {
+    if (name == "engine")
+        return PlayerKind::Engine;
+    if (name == "mcts")
+        return PlayerKind::Mcts;
+    if (name == "random")
+        return PlayerKind::Random;
+    throw std::invalid_argument("  : " + name);
+}
+
+char Tournament::playGame(int game, Player& x, Player& o, long long& moves, GameRecordWriter* writer) const {
+    Board board(config_.width, config_.height, '*', config_.k);
+    GameRecorder recorder;
+    if (writer)
+        board.setListener(&recorder);
+    std::mt19937_64 opening(config_.seed * 0x9E3779B97F4A7C15ULL + game / 2);
+    x.newGame(config_.seed + game);
+    o.newGame(config_.seed + game + 0x5851F42D4C957F2DULL);
+
+    int counter = 0;
+    char result = '*';
+    while (result == '*') {
+        int row = -1, col = -1;
+        bool found = counter < config_.openingMoves
+            ? Player::randomMove(board, opening, row, col)
+            : (counter % 2 == 0 ? x : o).chooseMove(board, counter, row, col);
+        if (!found) {
+            result = 'D';
+            break;
+        }
+        result = board.place(counter, row, col);
+        ++moves;
+    }
+    if (writer)
+        writer->write(recorder.record());
+    return result;
+}
+
+void Tournament::eloInterval(int wins, int losses, int draws, double& elo, double& low, double& high) {
+    int games = wins + losses + draws;
+    if (games == 0) {
+        elo = low = high = 0.0;
+        return;
+    }
+    double score = (wins + 0.5 * draws) / games;
+    double variance = (wins * std::pow(1.0 - score, 2) + draws * std::pow(0.5 - score, 2) + losses * std::pow(score, 2)) / games;
+    double margin = 1.96 * std::sqrt(variance / games);
+
+    double clampLow = 0.5 / games, clampHigh = 1.0 - 0.5 / games;
+    auto toElo = [clampLow, clampHigh](double s) {
+        s = std::min(clampHigh, std::max(clampLow, s));
+        return -400.0 * std::log10(1.0 / s - 1.0);
+    };
+    elo = toElo(score);
+    low = toElo(score - margin);
+    high = toElo(score + margin);
+}
+
+TournamentResult Tournament::run() {
+    auto start = std::chrono::steady_clock::now();
+    int threads = config_.threads > 0 ? config_.threads : static_cast<int>(std::thread::hardware_concurrency());
+    threads = std::max(1, std::min(threads, config_.games));
+
+    std::atomic<int> next(0);
+    std::mutex resultMutex;
+    TournamentResult result;
+    std::unique_ptr<GameRecordWriter> writer;
+    if (!config_.recordPath.empty())
+        writer.reset(new GameRecordWriter(config_.recordPath));
+    auto worker = [&] {
+        Player first(first_), second(second_);
+        int wins = 0, losses = 0, draws = 0;
+        long long moves = 0;
+        for (int game = next++; game < config_.games; game = next++) {
+            bool firstIsX = game % 2 == 0;
+            char winner = firstIsX ? playGame(game, first, second, moves, writer.get()) : playGame(game, second, first, moves, writer.get());
+            if (winner == 'D')
+                ++draws;
+            else if ((winner == 'X') == firstIsX)
+                ++wins;
+            else
+                ++losses;
+        }
+        std::lock_guard<std::mutex> lock(resultMutex);
+        result.wins += wins;
+        result.losses += losses;
+        result.draws += draws;
+        result.moves += moves;
+    };
+
+    std::vector<std::thread> workers;
+    for (int t = 1; t < threads; ++t)
+        workers.emplace_back(worker);
+    worker();
+    for (auto& w : workers)
+        w.join();
+    if (writer)
+        writer->flush();
+
+    result.games = result.wins + result.losses + result.draws;
+    result.score = (result.wins + 0.5 * result.draws) / result.games;
+    eloInterval(result.wins, result.losses, result.draws, result.elo, result.eloLow, result.eloHigh);
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if (result.seconds > 0)
+        result.gamesPerSecond = result.games / result.seconds;
+    return result;
+}
+
+std::string Tournament::report(const TournamentResult& result) const {
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(1)
+        << first_.name << " - " << second_.name << " (" << config_.width << "x" << config_.height << ", k=" << config_.k << ")\n"
+        << ": " << result.games << "  +" << result.wins << " -" << result.losses << " =" << result.draws
+        << "  : " << result.score * 100 << "%\n"
+        << ": " << std::showpos << result.elo << " [" << result.eloLow << ", " << result.eloHigh << "]" << std::noshowpos
+        << "\n  : " << result.gamesPerSecond << ", : " << result.moves << '\n';
+    return out.str();
+}
@@ -0,0 +1,62 @@
+#pragma once
+#include <string>
+#include <random>
+#include <cstdint>
+#include "../Board/Board.h"
+#include "../GameRecord/GameRecord.h"
+
+enum class PlayerKind { Engine, Mcts, Random };
+
+struct PlayerConfig {
+    std::string name = "engine";
+    PlayerKind kind = PlayerKind::Engine;
+    int millisPerMove = 0;
+    int maxDepth = 64;
+    long long maxNodes = 0;
+    long long simulations = 0;
+};
+
+struct TournamentConfig {
+    int width = 3;
+    int height = 3;
+    int k = 3;
+    int games = 100;
+    int threads = 0;
+    int openingMoves = 1;
+    uint64_t seed = 1;
+    std::string recordPath;
+};
+
+struct TournamentResult {
+    int games = 0;
+    int wins = 0;
+    int losses = 0;
+    int draws = 0;
+    long long moves = 0;
+    double score = 0.0;
+    double elo = 0.0;
+    double eloLow = 0.0;
+    double eloHigh = 0.0;
+    double seconds = 0.0;
+    double gamesPerSecond = 0.0;
+};
+
+class Tournament {
+public:
+    Tournament(const TournamentConfig& config, const PlayerConfig& first, const PlayerConfig& second);
+
+    TournamentResult run();
+    std::string report(const TournamentResult& result) const;
+
+    static PlayerKind parseKind(const std::string& name);
+    static void eloInterval(int wins, int losses, int draws, double& elo, double& low, double& high);
+
+private:
+    class Player;
+
+    TournamentConfig config_;
+    PlayerConfig first_;
+    PlayerConfig second_;
+
+    char playGame(int game, Player& x, Player& o, long long& moves, GameRecordWriter* writer) const;
+};
@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdio>
+#include "Tournament.h"
+
+static PlayerConfig player(const std::string& name) {
+    PlayerConfig config;
+    config.name = name;
+    config.kind = Tournament::parseKind(name);
+    config.simulations = 500;
+    return config;
+}
+
+TEST(TournamentTest, PerfectEngineNeverLosesToRandom) {
+    TournamentConfig config;
+    config.games = 40;
+    config.threads = 4;
+    config.openingMoves = 0;
+    Tournament t(config, player("engine"), player("random"));
+    TournamentResult r = t.run();
+    EXPECT_EQ(r.games, 40);
+    EXPECT_EQ(r.losses, 0);
+    EXPECT_GT(r.wins, 20);
+    EXPECT_GT(r.elo, 0.0);
+    EXPECT_LE(r.eloLow, r.elo);
+    EXPECT_GE(r.eloHigh, r.elo);
+    EXPECT_GT(r.gamesPerSecond, 0.0);
+}
+
+TEST(TournamentTest, CountsEveryGame) {
+    TournamentConfig config;
+    config.width = 4;
+    config.height = 4;
+    config.games = 50;
+    config.threads = 3;
+    config.openingMoves = 2;
+    Tournament t(config, player("random"), player("mcts"));
+    TournamentResult r = t.run();
+    EXPECT_EQ(r.wins + r.losses + r.draws, 50);
+    EXPECT_GE(r.moves, 50 * 5);
+    EXPECT_FALSE(t.report(r).empty());
+}
+
+TEST(TournamentTest, RecordsEveryGame) {
+    TournamentConfig config;
+    config.games = 12;
+    config.threads = 3;
+    config.recordPath = "tournament_games.bin";
+    Tournament t(config, player("random"), player("random"));
+    TournamentResult r = t.run();
+
+    GameRecordReader reader(config.recordPath);
+    GameRecordView view;
+    int games = 0;
+    long long moves = 0;
+    while (reader.next(view)) {
+        Board board(view.width, view.height, '*', view.k);
+        char result;
+        ASSERT_TRUE(view.replay(board, result));
+        EXPECT_NE(result, '*');
+        ++games;
+        moves += view.moveCount;
+    }
+    EXPECT_EQ(games, 12);
+    EXPECT_EQ(moves, r.moves);
+    std::remove(config.recordPath.c_str());
+}
+
+TEST(TournamentTest, EloFromScore) {
+    double elo, low, high;
+    Tournament::eloInterval(50, 50, 0, elo, low, high);
+    EXPECT_NEAR(elo, 0.0, 1e-9);
+    EXPECT_LT(low, 0.0);
+    EXPECT_GT(high, 0.0);
+
+    Tournament::eloInterval(75, 25, 0, elo, low, high);
+    EXPECT_NEAR(elo, 190.85, 0.01);
+
+    Tournament::eloInterval(10, 0, 0, elo, low, high);
+    EXPECT_TRUE(std::isfinite(elo));
+    EXPECT_GT(elo, 0.0);
+}
+
+TEST(TournamentTest, RejectsUnknownPlayer) {
+    EXPECT_THROW(Tournament::parseKind("human"), std::invalid_argument);
+    TournamentConfig config;
+    config.games = 0;
+    EXPECT_THROW(Tournament(config, player("random"), player("random")), std::invalid_argument);
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
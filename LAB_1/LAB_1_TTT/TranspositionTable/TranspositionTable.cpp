@@ -0,0 +1,108 @@
+#include "TranspositionTable.h"
+#include <stdexcept>
+
+static const uint64_t SCORE_BIAS = 1u << 23;
+static const uint64_t MOVE_NONE = (1u << 24) - 1;
+
+TranspositionTable::TranspositionTable(size_t megabytes) : buckets_(0), age_(0) {
+    resize(megabytes);
+}
+
+void TranspositionTable::resize(size_t megabytes) {
+    if (megabytes == 0) throw std::invalid_argument("      ");
+
+    size_t maxBuckets = megabytes * 1024 * 1024 / (sizeof(Slot) * BUCKET_SIZE);
+    size_t buckets = 1;
+    while (buckets * 2 <= maxBuckets)
+        buckets *= 2;
+    slots_.reset(new Slot[buckets * BUCKET_SIZE]);
+    buckets_ = buckets;
+    clear();
+}
+
+void TranspositionTable::clear() {
+    for (size_t n = 0; n < buckets_ * BUCKET_SIZE; ++n) {
+        slots_[n].key.store(0, std::memory_order_relaxed);
+        slots_[n].data.store(0, std::memory_order_relaxed);
+    }
+    age_ = 0;
+}
+
+void TranspositionTable::newSearch() {
+    age_ = (age_ + 1) & 63;
+}
+
+uint64_t TranspositionTable::pack(int depth, Bound bound, int score, int move, uint8_t age) {
+    uint64_t s = static_cast<uint64_t>(static_cast<int64_t>(score) + SCORE_BIAS) & 0xFFFFFF;
+    uint64_t m = move < 0 ? MOVE_NONE : static_cast<uint64_t>(move) & 0xFFFFFF;
+    uint64_t d = static_cast<uint64_t>(depth < 0 ? 0 : (depth > 255 ? 255 : depth));
+    return s | (m << 24) | (d << 48) | (static_cast<uint64_t>(bound) << 56) | (static_cast<uint64_t>(age & 63) << 58);
+}
+
+TtEntry TranspositionTable::unpack(uint64_t data) {
+    TtEntry entry;
+    entry.score = static_cast<int>(static_cast<int64_t>(data & 0xFFFFFF) - static_cast<int64_t>(SCORE_BIAS));
+    uint64_t m = (data >> 24) & 0xFFFFFF;
+    entry.move = m == MOVE_NONE ? -1 : static_cast<int>(m);
+    entry.depth = static_cast<int>((data >> 48) & 0xFF);
+    entry.bound = static_cast<Bound>((data >> 56) & 3);
+    return entry;
+}
+
+uint8_t TranspositionTable::ageOf(uint64_t data) {
+    return static_cast<uint8_t>(data >> 58);
+}
+
+bool TranspositionTable::probe(uint64_t key, TtEntry& entry, TtStats* stats) const {
+    if (stats)
+        ++stats->probes;
+    const Slot* bucket = &slots_[(key & (buckets_ - 1)) * BUCKET_SIZE];
+    for (int n = 0; n < BUCKET_SIZE; ++n) {
+        uint64_t data = bucket[n].data.load(std::memory_order_relaxed);
+        uint64_t stored = bucket[n].key.load(std::memory_order_relaxed);
+        if (data != 0 && (stored ^ data) == key) {
+            entry = unpack(data);
+            if (stats)
+                ++stats->hits;
+            return true;
+        }
+    }
+    return false;
+}
+
+void TranspositionTable::store(uint64_t key, int depth, Bound bound, int score, int move) {
+    Slot* bucket = &slots_[(key & (buckets_ - 1)) * BUCKET_SIZE];
+
+    Slot* victim = nullptr;
+    int victimWorth = 0;
+    for (int n = 0; n < BUCKET_SIZE; ++n) {
+        uint64_t data = bucket[n].data.load(std::memory_order_relaxed);
+        uint64_t stored = bucket[n].key.load(std::memory_order_relaxed);
+        if (data == 0) {
+            victim = &bucket[n];
+            break;
+        }
+        if ((stored ^ data) == key) {
+            TtEntry old = unpack(data);
+            if (depth < old.depth && bound != Bound::Exact && ageOf(data) == age_)
+                return;
+            if (move < 0)
+                move = old.move;
+            victim = &bucket[n];
+            break;
+        }
+        int worth = unpack(data).depth - 8 * ((age_ - ageOf(data)) & 63);
+        if (!victim || worth < victimWorth) {
+            victim = &bucket[n];
+            victimWorth = worth;
+        }
+    }
+
+    uint64_t data = pack(depth, bound, score, move, age_);
+    victim->key.store(key ^ data, std::memory_order_relaxed);
+    victim->data.store(data, std::memory_order_relaxed);
+}
+
+size_t TranspositionTable::capacity() const {
+    return buckets_ * BUCKET_SIZE;
+}
@@ -0,0 +1,60 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+
+enum class Bound : uint8_t { None = 0, Exact = 1, Lower = 2, Upper = 3 };
+
+struct TtEntry {
+    int score = 0;
+    int depth = 0;
+    Bound bound = Bound::None;
+    int move = -1;
+};
+
+//       :   
+//        -  Lazy SMP
+struct TtStats {
+    uint64_t probes = 0;
+    uint64_t hits = 0;
+
+    double hitRate() const { return probes == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(probes); }
+    TtStats& operator+=(const TtStats& other) {
+        probes += other.probes;
+        hits += other.hits;
+        return *this;
+    }
+};
+
+class TranspositionTable {
+public:
+    static constexpr int BUCKET_SIZE = 4;
+
+    explicit TranspositionTable(size_t megabytes = 16);
+    TranspositionTable(const TranspositionTable&) = delete;
+    TranspositionTable& operator=(const TranspositionTable&) = delete;
+
+    void resize(size_t megabytes);
+    void clear();
+    void newSearch();
+
+    bool probe(uint64_t key, TtEntry& entry, TtStats* stats = nullptr) const;
+    void store(uint64_t key, int depth, Bound bound, int score, int move);
+
+    size_t capacity() const;
+
+private:
+    struct Slot {
+        std::atomic<uint64_t> key;
+        std::atomic<uint64_t> data;
+    };
+
+    std::unique_ptr<Slot[]> slots_;
+    size_t buckets_;
+    uint8_t age_;
+
+    static uint64_t pack(int depth, Bound bound, int score, int move, uint8_t age);
+    static TtEntry unpack(uint64_t data);
+    static uint8_t ageOf(uint64_t data);
+};
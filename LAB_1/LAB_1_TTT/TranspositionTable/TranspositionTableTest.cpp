@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include "TranspositionTable.h"
+
+TEST(TranspositionTableTest, StoreAndProbe) {
+    TranspositionTable tt(1);
+    tt.store(12345, 7, Bound::Lower, -999990, 42);
+
+    TtEntry e;
+    ASSERT_TRUE(tt.probe(12345, e));
+    EXPECT_EQ(e.depth, 7);
+    EXPECT_EQ(e.bound, Bound::Lower);
+    EXPECT_EQ(e.score, -999990);
+    EXPECT_EQ(e.move, 42);
+    EXPECT_FALSE(tt.probe(54321, e));
+}
+
+TEST(TranspositionTableTest, MissingMoveIsNegative) {
+    TranspositionTable tt(1);
+    tt.store(1, 3, Bound::Exact, 0, -1);
+    TtEntry e;
+    ASSERT_TRUE(tt.probe(1, e));
+    EXPECT_EQ(e.move, -1);
+}
+
+TEST(TranspositionTableTest, ShallowResultDoesNotOverwriteDeep) {
+    TranspositionTable tt(1);
+    tt.store(99, 10, Bound::Lower, 5, 3);
+    tt.store(99, 2, Bound::Upper, 1, 4);
+    TtEntry e;
+    ASSERT_TRUE(tt.probe(99, e));
+    EXPECT_EQ(e.depth, 10);
+
+    tt.newSearch();
+    tt.store(99, 2, Bound::Upper, 1, 4);
+    ASSERT_TRUE(tt.probe(99, e));
+    EXPECT_EQ(e.depth, 2);
+}
+
+TEST(TranspositionTableTest, FullBucketEvictsShallowest) {
+    TranspositionTable tt(1);
+    uint64_t stride = tt.capacity() / TranspositionTable::BUCKET_SIZE;
+    for (int n = 0; n < TranspositionTable::BUCKET_SIZE; ++n)
+        tt.store(5 + stride * n, 10 + n, Bound::Exact, n, n);
+    tt.store(5 + stride * 100, 20, Bound::Exact, 0, 0);
+
+    TtEntry e;
+    EXPECT_FALSE(tt.probe(5, e));
+    EXPECT_TRUE(tt.probe(5 + stride, e));
+    EXPECT_TRUE(tt.probe(5 + stride * 100, e));
+}
+
+TEST(TranspositionTableTest, CountsHitRate) {
+    TranspositionTable tt(1);
+    tt.store(7, 1, Bound::Exact, 0, 0);
+    TtEntry e;
+    TtStats stats;
+    tt.probe(7, e, &stats);
+    tt.probe(8, e, &stats);
+    tt.probe(7, e);
+    EXPECT_EQ(stats.probes, 2u);
+    EXPECT_EQ(stats.hits, 1u);
+    EXPECT_DOUBLE_EQ(stats.hitRate(), 0.5);
+
+    TtStats other;
+    tt.probe(7, e, &other);
+    stats += other;
+    EXPECT_EQ(stats.probes, 3u);
+    EXPECT_EQ(stats.hits, 2u);
+    tt.clear();
+    EXPECT_FALSE(tt.probe(7, e));
+}
+
+TEST(TranspositionTableTest, ConcurrentWritersNeverYieldTornEntries) {
+    TranspositionTable tt(1);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+        threads.emplace_back([&tt, t] {
+            for (int n = 0; n < 20000; ++n) {
+                uint64_t key = static_cast<uint64_t>(n % 64) * 0x9E3779B97F4A7C15ULL + 1;
+                tt.store(key, t + 1, Bound::Exact, static_cast<int>(key & 1023), static_cast<int>(key & 4095));
+            }
+        });
+    for (auto& th : threads)
+        th.join();
+
+    for (int n = 0; n < 64; ++n) {
+        uint64_t key = static_cast<uint64_t>(n) * 0x9E3779B97F4A7C15ULL + 1;
+        TtEntry e;
+        if (tt.probe(key, e)) {
+            EXPECT_EQ(e.score, static_cast<int>(key & 1023));
+            EXPECT_EQ(e.move, static_cast<int>(key & 4095));
+        }
+    }
+}
+
+TEST(TranspositionTableTest, RejectsZeroSize) {
+    EXPECT_THROW(TranspositionTable(0), std::invalid_argument);
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -2,6 +2,8 @@
 #include <iostream>
 #include <conio.h>
 #include <windows.h>
+#include <thread>
+#include "../Engine/Engine.h"
 
 TttGame::TttGame(int width, int height) {
     this->width = (width >= 3 ? width : 3);
@@ -10,7 +12,7 @@ TttGame::TttGame(int width, int height) {
 
 void TttGame::game() {
     mainmenu();
-    Board board(width, height, '*');
+    Board board(width, height, '*', winLength);
 
     char choosedMenuOption = ' ';
     int whosMooveCounter = 0;
@@ -18,7 +20,8 @@ void TttGame::game() {
     while (choosedMenuOption != 0x1B) {
         system("cls");
         std::cout << board << "\n: " << ((whosMooveCounter % 2 == 0) ? 'X' : 'O') << "\n"
-            << "1 -  \n2 -   \n3 -   \n\nEsc - \n";
+            << "1 -  \n2 -   \n3 -   \n4 -  \n"
+            << "5 -  \n6 -  \n\nEsc - \n";
 
         choosedMenuOption = _getch();
         system("cls");
@@ -36,6 +39,27 @@ void TttGame::game() {
             checkCellsUnitHandler(board);
             break;
         }
+        case '4': {
+            if (computerMoveHandler(board, whosMooveCounter))
+                return;
+            break;
+        }
+        case '5': {
+            if (!board.undo(whosMooveCounter)) {
+                std::cout << "   \n";
+                Sleep(750);
+            }
+            break;
+        }
+        case '6': {
+            if (!board.redo(whosMooveCounter)) {
+                std::cout << "   \n";
+                Sleep(750);
+            }
+            else if (gameOverHandler(board, board.state()))
+                return;
+            break;
+        }
         case 0x1B: break;
         default:
             std::cout << " ...\n";
@@ -49,6 +73,75 @@ bool TttGame::placementHandler(Board& board, int& whosMooveCounter) {
     std::cout << "  :" << ((whosMooveCounter % 2 == 0) ? 'X' : 'O') << " (i j): ";
     cellSelection(board, i, j);
     char resultboof = board.place(whosMooveCounter, i, j);
+    return gameOverHandler(board, resultboof);
+}
+
+bool TttGame::tablebaseMove(const Board& board, int& i, int& j) {
+    if (!Tablebase::supports(board.width(), board.height()))
+        return false;
+    //   :     -tablebase,   
+    //     
+    if (!tablebase.matches(board)) {
+        try {
+            tablebase.open(Tablebase::fileName(board.width(), board.height(), board.winLength()));
+        }
+        catch (const std::exception&) {
+            return false;
+        }
+    }
+    try {
+        return tablebase.matches(board) && tablebase.bestMove(board, i, j);
+    }
+    catch (const std::exception&) {
+        return false;
+    }
+}
+
+bool TttGame::computerMoveHandler(Board& board, int& whosMooveCounter) {
+    int ti, tj;
+    if (tablebaseMove(board, ti, tj)) {
+        std::cout << " : " << ti << ' ' << tj << " (  )\n";
+        Sleep(750);
+        char resultboof = board.place(whosMooveCounter, ti, tj);
+        return gameOverHandler(board, resultboof);
+    }
+
+    if (board.winLength() >= 5 && board.width() * board.height() > 64) {
+        MctsLimits limits;
+        limits.maxMillis = 1000;
+        limits.threads = static_cast<int>(std::thread::hardware_concurrency());
+        MctsResult result = mcts.search(board, whosMooveCounter, limits);
+        if (result.row < 0)
+            return 0;
+        std::cout << " : " << result.row << ' ' << result.col << " ( " << result.simulations << ")\n";
+        Sleep(750);
+        char resultboof = board.place(whosMooveCounter, result.row, result.col);
+        return gameOverHandler(board, resultboof);
+    }
+
+    Engine engine;
+    if (!book.matches(board)) {
+        try {
+            book.open(OpeningBook::fileName(board.width(), board.height(), board.winLength()));
+        }
+        catch (const std::runtime_error&) {
+        }
+    }
+    if (book.matches(board))
+        engine.setBook(&book);
+    SearchLimits limits;
+    limits.maxMillis = 1000;
+    limits.threads = static_cast<int>(std::thread::hardware_concurrency());
+    SearchResult result = engine.search(board, whosMooveCounter, limits);
+    if (result.row < 0)
+        return 0;
+    std::cout << " : " << result.row << ' ' << result.col << " ( " << result.depth << ")\n";
+    Sleep(750);
+    char resultboof = board.place(whosMooveCounter, result.row, result.col);
+    return gameOverHandler(board, resultboof);
+}
+
+bool TttGame::gameOverHandler(const Board& board, char resultboof) {
     if (resultboof == 'X' || resultboof == 'O' || resultboof == 'D') {
         system("cls");
         std::cout << board;
@@ -62,7 +155,7 @@ bool TttGame::placementHandler(Board& board, int& whosMooveCounter) {
     return 0;
 }
 
-void TttGame::checkAccessHandler(Board& board) {
+void TttGame::checkAccessHandler(const Board& board) {
     int i, j;
 
     std::cout << "   : ";
@@ -71,7 +164,7 @@ void TttGame::checkAccessHandler(Board& board) {
     Sleep(750);
 }
 
-void TttGame::checkCellsUnitHandler(Board& board) {
+void TttGame::checkCellsUnitHandler(const Board& board) {
     int i, j;
     std::cout << "   : ";
     while (std::cin >> i >> j) {
@@ -89,7 +182,7 @@ void TttGame::checkCellsUnitHandler(Board& board) {
     Sleep(750);
 }
 
-bool TttGame::cellSelection(const Board board, int& i, int& j) {
+bool TttGame::cellSelection(const Board& board, int& i, int& j) {
     int icheckboof, jcheckboof;
     std::cout << "   : ";
     while (std::cin >> icheckboof >> jcheckboof) {
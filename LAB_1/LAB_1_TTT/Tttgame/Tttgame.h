@@ -1,6 +1,9 @@
 #pragma once
 #include "../Board/Board.h"
 #include "../TttMenu/TttMenu.h"
+#include "../Mcts/Mcts.h"
+#include "../Tablebase/Tablebase.h"
+#include "../OpeningBook/OpeningBook.h"
 
 class TttGame : public TttMenu {
 public:
@@ -9,7 +12,15 @@ public:
 
 protected:
     bool placementHandler(Board& board, int& whosMooveCounter);
-    void checkAccessHandler(Board& board);
-    void checkCellsUnitHandler(Board& board);
-    bool cellSelection(const Board board, int& i, int& j);
+    bool computerMoveHandler(Board& board, int& whosMooveCounter);
+    bool tablebaseMove(const Board& board, int& i, int& j);
+    bool gameOverHandler(const Board& board, char resultboof);
+    void checkAccessHandler(const Board& board);
+    void checkCellsUnitHandler(const Board& board);
+    bool cellSelection(const Board& board, int& i, int& j);
+
+private:
+    Mcts mcts;
+    Tablebase tablebase;
+    OpeningBook book;
 };
@@ -33,4 +33,10 @@ void TttMenu::sizechange() {
         std::cin.clear(); std::cin.ignore(10000, '\n');
         std::cout << " . : ";
     }
+
+    std::cout << "     (>=3): ";
+    while (!(std::cin >> winLength) || winLength < 3 || (winLength > width && winLength > height)) {
+        std::cin.clear(); std::cin.ignore(10000, '\n');
+        std::cout << " . : ";
+    }
 }
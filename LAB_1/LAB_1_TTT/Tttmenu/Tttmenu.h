@@ -4,6 +4,7 @@ class TttMenu {
 protected:
     int width = 3;
     int height = 3;
+    int winLength = 3;
 
     void mainmenu();
     void sizechange();
@@ -1,10 +1,172 @@
 ﻿#include "TttGame/TttGame.h"
+#include "Tournament/Tournament.h"
+#include "GameServer/GameServer.h"
+#include "OpeningBook/OpeningBook.h"
+#include "Tablebase/Tablebase.h"
+#include "Dfpn/Dfpn.h"
+#include "Perft/Perft.h"
+#include <iostream>
+#include <string>
 #include <windows.h>
 
-int main() {
+int main(int argc, char* argv[]) {
 	SetConsoleCP(1251);
 	SetConsoleOutputCP(1251);
 
+	bool tournamentMode = false;
+	bool serverMode = false;
+	int bookPlies = -1;
+	bool tablebaseMode = false;
+	bool solveMode = false;
+	int perftDepth = -2;
+	int perftHash = 0;
+	TournamentConfig config;
+	PlayerConfig first, second;
+	second.name = "random";
+	second.kind = PlayerKind::Random;
+	for (int i = 1; i < argc; ++i) {
+		std::string a = argv[i];
+
+		if (a == "-tournament") {
+			tournamentMode = true;
+			continue;
+		}
+
+		if (a == "-server") {
+			serverMode = true;
+			continue;
+		}
+
+		if (a == "-perft" && i + 1 < argc) {
+			perftDepth = std::stoi(argv[++i]);
+			continue;
+		}
+
+		if (a == "-hash" && i + 1 < argc) {
+			perftHash = std::stoi(argv[++i]);
+			continue;
+		}
+
+		if (a == "-solve") {
+			solveMode = true;
+			continue;
+		}
+
+		if (a == "-book" && i + 1 < argc) {
+			bookPlies = std::stoi(argv[++i]);
+			continue;
+		}
+
+		if (a == "-tablebase") {
+			tablebaseMode = true;
+			continue;
+		}
+
+		if (a == "-size" && i + 3 < argc) {
+			config.width = std::stoi(argv[++i]);
+			config.height = std::stoi(argv[++i]);
+			config.k = std::stoi(argv[++i]);
+			continue;
+		}
+
+		if (a == "-games" && i + 1 < argc) {
+			config.games = std::stoi(argv[++i]);
+			continue;
+		}
+
+		if (a == "-threads" && i + 1 < argc) {
+			config.threads = std::stoi(argv[++i]);
+			continue;
+		}
+
+		if (a == "-opening" && i + 1 < argc) {
+			config.openingMoves = std::stoi(argv[++i]);
+			continue;
+		}
+
+		if (a == "-ms" && i + 1 < argc) {
+			first.millisPerMove = second.millisPerMove = std::stoi(argv[++i]);
+			continue;
+		}
+
+		if (a == "-record" && i + 1 < argc) {
+			config.recordPath = argv[++i];
+			continue;
+		}
+
+		if ((a == "-a" || a == "-b") && i + 1 < argc) {
+			PlayerConfig& p = (a == "-a") ? first : second;
+			p.name = argv[++i];
+			p.kind = Tournament::parseKind(p.name);
+			continue;
+		}
+	}
+
+	if (serverMode) {
+		std::ios::sync_with_stdio(false);
+		GameServer server(std::cout);
+		server.serve(std::cin);
+		return 0;
+	}
+
+	if (perftDepth >= -1) {
+		PerftOptions options;
+		options.depth = perftDepth;
+		options.threads = config.threads;
+		options.hashMegabytes = perftHash;
+		Perft perft(config.width, config.height, config.k);
+		std::cout << perft.report(perft.run(options));
+		return 0;
+	}
+
+	if (solveMode) {
+		Board board(config.width, config.height, '*', config.k);
+		DfpnLimits limits;
+		limits.maxMillis = first.millisPerMove;
+		Dfpn solver;
+		DfpnResult solved = solver.solve(board, 0, limits);
+		std::cout << config.width << 'x' << config.height << ", k=" << config.k << ": " << Dfpn::name(solved.result)
+			<< ", узлов " << solved.nodes << ", дерево доказательства " << solved.proofSize
+			<< ", " << solved.millis << " мс\n";
+		return 0;
+	}
+
+	if (bookPlies >= 0) {
+		BookBuildOptions options;
+		options.plies = bookPlies;
+		options.threads = config.threads;
+		if (first.millisPerMove > 0)
+			options.millisPerPosition = first.millisPerMove;
+		std::string path = OpeningBook::fileName(config.width, config.height, config.k);
+		BookBuildResult built = OpeningBook::build(config.width, config.height, config.k, options, path);
+		std::cout << path << ": позиций " << built.positions << ", посчитано " << built.searched
+			<< ", из журнала " << built.resumed << '\n';
+		return built.complete ? 0 : 1;
+	}
+
+	if (tablebaseMode) {
+		std::string path = Tablebase::fileName(config.width, config.height, config.k);
+		try {
+			Tablebase::generate(config.width, config.height, config.k, path);
+		}
+		catch (const std::exception& e) {
+			std::cout << e.what() << '\n';
+			return 1;
+		}
+		std::cout << path << ": таблица окончаний построена\n";
+		return 0;
+	}
+
+	if (tournamentMode) {
+		if (first.millisPerMove == 0 && first.kind != PlayerKind::Random)
+			first.millisPerMove = 20;
+		if (second.millisPerMove == 0 && second.kind != PlayerKind::Random)
+			second.millisPerMove = 20;
+		Tournament tournament(config, first, second);
+		std::cout << tournament.report(tournament.run());
+		return 0;
+	}
+
 	TttGame g(3, 3);
 	g.game();
 	return 0;
@@ -0,0 +1,264 @@
+#include "BatchRunner.h"
+#include <algorithm>
+#include <stdexcept>
+#include <limits>
+#include "../Tape/Tape.h"
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+static constexpr int NEXT_SHIFT = 10;
+static constexpr int32_t MAX_PACKED_STATES = (1 << (31 - NEXT_SHIFT)) - 1;
+static_assert(TransitionTable::SYMBOLS == 256, "    state << 8 | symbol");
+
+BatchRunner::BatchRunner(int laneCount, int windowCells) : lanes(laneCount), window(windowCells){
+    if (lanes < MIN_LANES || lanes > MAX_LANES)
+        throw std::invalid_argument("     8  32");
+    if (window < 8)
+        throw std::invalid_argument("   ");
+    if (window > std::numeric_limits<int32_t>::max() / MAX_LANES - 4)
+        throw std::invalid_argument("   ");
+
+    laneBase.assign(lanes, 0);
+    laneState.assign(lanes, TransitionTable::HALT);
+    laneHead.assign(lanes, 0);
+    laneOrigin.assign(lanes, 0);
+    laneActive.assign(lanes, 0);
+    laneSteps.assign(lanes, 0);
+    laneLimit.assign(lanes, 0);
+    laneJob.assign(lanes, -1);
+    for (int lane = 0; lane < lanes; ++lane)
+        laneOrigin[lane] = lane * window;
+    //    4    ,      
+    laneTape.assign(static_cast<size_t>(lanes) * window + 3, TapeBase::BLANK);
+}
+
+BatchResult BatchRunner::RunScalar(const TransitionTable& table, int state, const std::string& tape,
+    size_t head, long long steps, long long maxSteps){
+    Tape cells(tape);
+    for (size_t i = 0; i < head; ++i)
+        cells.MoveRight();
+
+    BatchResult result;
+    while (maxSteps <= 0 || steps < maxSteps){
+        if (state == TransitionTable::HALT){
+            result.halted = true;
+            break;
+        }
+        const Transition& t = table.Get(state, cells.GetCurrentSymbol());
+        if (t.next == TransitionTable::HALT){
+            result.halted = true;
+            break;
+        }
+        cells.WriteSymbol(t.write);
+        if (t.move < 0)
+            cells.MoveLeft();
+        else if (t.move > 0)
+            cells.MoveRight();
+        state = t.next;
+        ++steps;
+    }
+
+    result.steps = steps;
+    result.state = (state == TransitionTable::HALT) ? std::string() : table.GetStateName(state);
+    result.tape = cells.ToString();
+    return result;
+}
+
+int32_t BatchRunner::Pack(const TransitionTable& table){
+    auto found = packedBase.find(&table);
+    if (found != packedBase.end())
+        return found->second;
+
+    size_t count = static_cast<size_t>(table.GetStateCount()) * TransitionTable::SYMBOLS;
+    if (table.GetStateCount() > MAX_PACKED_STATES
+        || packed.size() + count > static_cast<size_t>(std::numeric_limits<int32_t>::max()))
+        return -1;
+
+    int32_t base = static_cast<int32_t>(packed.size());
+    const Transition* data = table.Data();
+    for (size_t i = 0; i < count; ++i){
+        const Transition& t = data[i];
+        packed.push_back(t.next == TransitionTable::HALT ? 0
+            : (t.next + 1) << NEXT_SHIFT | (t.move + 1) << 8 | static_cast<unsigned char>(t.write));
+    }
+    packedBase.emplace(&table, base);
+    return base;
+}
+
+bool BatchRunner::LoadLane(int lane, const std::vector<BatchJob>& jobs, size_t job){
+    const BatchJob& j = jobs[job];
+    size_t origin = window / 4;
+    if (j.table->GetStartState() == TransitionTable::HALT || origin + j.tape.size() + 1 >= static_cast<size_t>(window))
+        return false;
+    int32_t base = Pack(*j.table);
+    if (base < 0)
+        return false;
+
+    char* cells = &laneTape[static_cast<size_t>(laneOrigin[lane])];
+    std::fill(cells, cells + window, TapeBase::BLANK);
+    std::copy(j.tape.begin(), j.tape.end(), cells + origin);
+
+    laneBase[lane] = base;
+    laneState[lane] = j.table->GetStartState();
+    laneHead[lane] = static_cast<int32_t>(origin);
+    laneActive[lane] = -1;
+    laneSteps[lane] = 0;
+    laneLimit[lane] = j.maxSteps;
+    laneJob[lane] = static_cast<int32_t>(job);
+    return true;
+}
+
+void BatchRunner::FinishLane(int lane, const std::vector<BatchJob>& jobs, std::vector<BatchResult>& results){
+    const BatchJob& j = jobs[laneJob[lane]];
+    const char* cells = &laneTape[static_cast<size_t>(laneOrigin[lane])];
+    results[laneJob[lane]] = RunScalar(*j.table, laneState[lane], std::string(cells, cells + window),
+        laneHead[lane], laneSteps[lane], laneLimit[lane]);
+    laneJob[lane] = -1;
+    laneActive[lane] = 0;
+    laneState[lane] = TransitionTable::HALT;
+    laneHead[lane] = 0;
+}
+
+//   ; true,        
+bool BatchRunner::StepLane(int lane){
+    if (!laneActive[lane])
+        return false;
+    char* cell = &laneTape[static_cast<size_t>(laneOrigin[lane]) + laneHead[lane]];
+    int32_t entry = packed[static_cast<size_t>(laneBase[lane]) + (static_cast<size_t>(laneState[lane]) << 8)
+        + static_cast<unsigned char>(*cell)];
+    int32_t next = entry >> NEXT_SHIFT;
+    if (next == 0){
+        laneActive[lane] = 0;
+        return true;
+    }
+
+    *cell = static_cast<char>(entry & 0xFF);
+    int32_t head = laneHead[lane] + ((entry >> 8) & 3) - 1;
+    laneHead[lane] = head;
+    laneState[lane] = next - 1;
+    ++laneSteps[lane];
+    if (head == 0 || head == window - 1){
+        laneActive[lane] = 0;
+        return true;
+    }
+    return false;
+}
+
+#if defined(__AVX2__)
+//    :         ,
+// ,         
+bool BatchRunner::StepVector(int first){
+    const __m256i active = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&laneActive[first]));
+    if (_mm256_testz_si256(active, active))
+        return false;
+
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i one = _mm256_set1_epi32(1);
+    __m256i state = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&laneState[first]));
+    __m256i head = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&laneHead[first]));
+    __m256i base = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&laneBase[first]));
+    __m256i origin = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&laneOrigin[first]));
+
+    __m256i cell = _mm256_add_epi32(origin, head);
+    __m256i symbol = _mm256_and_si256(_mm256_set1_epi32(0xFF),
+        _mm256_mask_i32gather_epi32(zero, reinterpret_cast<const int*>(laneTape.data()), cell, active, 1));
+    __m256i index = _mm256_add_epi32(base, _mm256_or_si256(_mm256_slli_epi32(state, 8), symbol));
+    __m256i entry = _mm256_mask_i32gather_epi32(zero, packed.data(), index, active, 4);
+
+    __m256i next = _mm256_srli_epi32(entry, NEXT_SHIFT);
+    __m256i live = _mm256_andnot_si256(_mm256_cmpeq_epi32(next, zero), active);
+    __m256i move = _mm256_sub_epi32(_mm256_and_si256(_mm256_srli_epi32(entry, 8), _mm256_set1_epi32(3)), one);
+
+    head = _mm256_add_epi32(head, _mm256_and_si256(move, live));
+    state = _mm256_blendv_epi8(state, _mm256_sub_epi32(next, one), live);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(&laneHead[first]), head);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(&laneState[first]), state);
+
+    // live  -1   ,    
+    __m256i* steps = reinterpret_cast<__m256i*>(&laneSteps[first]);
+    _mm256_storeu_si256(steps, _mm256_sub_epi64(_mm256_loadu_si256(steps),
+        _mm256_cvtepi32_epi64(_mm256_castsi256_si128(live))));
+    _mm256_storeu_si256(steps + 1, _mm256_sub_epi64(_mm256_loadu_si256(steps + 1),
+        _mm256_cvtepi32_epi64(_mm256_extracti128_si256(live, 1))));
+
+    __m256i edge = _mm256_or_si256(_mm256_cmpeq_epi32(head, zero), _mm256_cmpeq_epi32(head, _mm256_set1_epi32(window - 1)));
+    __m256i done = _mm256_and_si256(active, _mm256_or_si256(_mm256_cmpeq_epi32(live, zero), edge));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(&laneActive[first]), _mm256_andnot_si256(done, active));
+
+    //  AVX2     ,       
+    alignas(32) int32_t cells[8];
+    alignas(32) int32_t writes[8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(cells), cell);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(writes), entry);
+    int mask = _mm256_movemask_ps(_mm256_castsi256_ps(live));
+    for (int i = 0; i < 8; ++i)
+        if (mask & (1 << i))
+            laneTape[cells[i]] = static_cast<char>(writes[i] & 0xFF);
+
+    return !_mm256_testz_si256(done, done);
+}
+#else
+bool BatchRunner::StepVector(int first){
+    bool anyDone = false;
+    for (int lane = first; lane < first + 8; ++lane)
+        anyDone = StepLane(lane) || anyDone;
+    return anyDone;
+}
+#endif
+
+//     ,  -      
+void BatchRunner::Advance(int64_t iterations){
+    int vectorLanes = lanes / 8 * 8;
+    for (int64_t i = 0; i < iterations; ++i){
+        bool anyDone = false;
+        for (int lane = 0; lane < vectorLanes; lane += 8)
+            anyDone = StepVector(lane) || anyDone;
+        for (int lane = vectorLanes; lane < lanes; ++lane)
+            anyDone = StepLane(lane) || anyDone;
+        if (anyDone)
+            return;
+    }
+}
+
+std::vector<BatchResult> BatchRunner::Run(const std::vector<BatchJob>& jobs){
+    std::vector<BatchResult> results(jobs.size());
+    packed.clear();
+    packedBase.clear();
+    size_t nextJob = 0;
+
+    auto refill = [&](int lane){
+        while (nextJob < jobs.size()){
+            size_t job = nextJob++;
+            if (LoadLane(lane, jobs, job))
+                return;
+            const BatchJob& j = jobs[job];
+            results[job] = RunScalar(*j.table, j.table->GetStartState(), j.tape, 0, 0, j.maxSteps);
+        }
+    };
+
+    for (int lane = 0; lane < lanes; ++lane)
+        refill(lane);
+
+    for (;;){
+        bool anyActive = false;
+        //      :      
+        int64_t budget = std::numeric_limits<int64_t>::max();
+        for (int lane = 0; lane < lanes; ++lane){
+            anyActive = anyActive || laneJob[lane] >= 0;
+            if (laneJob[lane] >= 0 && laneLimit[lane] > 0)
+                budget = std::min(budget, laneLimit[lane] - laneSteps[lane]);
+        }
+        if (!anyActive)
+            break;
+        Advance(budget);
+
+        for (int lane = 0; lane < lanes; ++lane){
+            if (laneJob[lane] >= 0 && (!laneActive[lane] || (laneLimit[lane] > 0 && laneSteps[lane] >= laneLimit[lane]))){
+                FinishLane(lane, jobs, results);
+                refill(lane);
+            }
+        }
+    }
+    return results;
+}
@@ -0,0 +1,56 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <unordered_map>
+#include "../TransitionTable/TransitionTable.h"
+
+struct BatchJob {
+    const TransitionTable* table;
+    std::string tape;
+    long long maxSteps = 0;
+};
+
+struct BatchResult {
+    bool halted = false;
+    long long steps = 0;
+    std::string state;
+    std::string tape;
+};
+
+class BatchRunner{
+private:
+    int lanes;
+    int window;
+
+    //        : (next + 1) << 10 | (move + 1) << 8 | write, 0 - 
+    std::vector<int32_t> packed;
+    std::unordered_map<const TransitionTable*, int32_t> packedBase;
+
+    std::vector<int32_t> laneBase;
+    std::vector<int32_t> laneState;
+    std::vector<int32_t> laneHead;
+    std::vector<int32_t> laneOrigin;
+    std::vector<int32_t> laneActive;
+    std::vector<int64_t> laneSteps;
+    std::vector<int64_t> laneLimit;
+    std::vector<int32_t> laneJob;
+    std::vector<char> laneTape;
+
+    int32_t Pack(const TransitionTable& table);
+    bool LoadLane(int lane, const std::vector<BatchJob>& jobs, size_t job);
+    void FinishLane(int lane, const std::vector<BatchJob>& jobs, std::vector<BatchResult>& results);
+    void Advance(int64_t iterations);
+    bool StepLane(int lane);
+    bool StepVector(int first);
+    static BatchResult RunScalar(const TransitionTable& table, int state, const std::string& tape,
+        size_t head, long long steps, long long maxSteps);
+
+public:
+    static constexpr int MIN_LANES = 8;
+    static constexpr int MAX_LANES = 32;
+
+    BatchRunner(int laneCount = 16, int windowCells = 256);
+    std::vector<BatchResult> Run(const std::vector<BatchJob>& jobs);
+    ~BatchRunner() = default;
+};
@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <memory>
+
+#include "BatchRunner.h"
+
+static std::string RandomProgram(unsigned& seed, std::string& tape) {
+    auto next = [&seed](unsigned n) {
+        seed = seed * 1103515245u + 12345u;
+        return (seed >> 16) % n;
+    };
+    static const char symbols[] = { '0', '1', '_' };
+    static const char moves[] = { 'L', 'R', 'N' };
+    static const char* states[] = { "A", "B", "C", "D" };
+
+    tape.clear();
+    unsigned length = next(12);
+    for (unsigned i = 0; i < length; ++i)
+        tape.push_back(symbols[next(2)]);
+
+    std::ostringstream out;
+    out << (tape.empty() ? "_" : tape) << "\n";
+    for (const char* state : states)
+        for (char read : symbols)
+            if (next(5) != 0)
+                out << state << ' ' << read << ' ' << symbols[next(3)] << ' '
+                    << moves[next(3)] << ' ' << states[next(4)] << "\n";
+    return out.str();
+}
+
+TEST(BatchRunnerTest, LaneCountIsValidated) {
+    EXPECT_THROW(BatchRunner(4), std::invalid_argument);
+    EXPECT_THROW(BatchRunner(64), std::invalid_argument);
+    EXPECT_NO_THROW(BatchRunner(8));
+}
+
+TEST(BatchRunnerTest, MatchesStepOnRandomMachines) {
+    unsigned seed = 2024;
+    std::vector<TuringMachineLogic> machines(300);
+    std::vector<std::unique_ptr<TransitionTable>> tables;
+    std::vector<BatchJob> jobs;
+    for (auto& machine : machines) {
+        std::string tape;
+        machine.LoadFromString(RandomProgram(seed, tape));
+        tables.push_back(std::make_unique<TransitionTable>(machine));
+        jobs.push_back(BatchJob{ tables.back().get(), tape, 500 });
+    }
+
+    BatchRunner runner(8, 64);
+    std::vector<BatchResult> results = runner.Run(jobs);
+    ASSERT_EQ(results.size(), machines.size());
+
+    for (size_t i = 0; i < machines.size(); ++i) {
+        machines[i].SetTape(jobs[i].tape);
+        RunLimits limits;
+        limits.maxSteps = 500;
+        RunResult expected = machines[i].Run(limits);
+        EXPECT_EQ(results[i].halted, expected.status == RunStatus::Halted) << i;
+        EXPECT_EQ(results[i].steps, expected.steps) << i;
+        EXPECT_EQ(results[i].state, expected.state) << i;
+        EXPECT_EQ(results[i].tape, expected.tape) << i;
+    }
+}
+
+TEST(BatchRunnerTest, LaneCountDoesNotChangeResults) {
+    unsigned seed = 99;
+    std::vector<TuringMachineLogic> machines(100);
+    std::vector<std::unique_ptr<TransitionTable>> tables;
+    std::vector<BatchJob> jobs;
+    for (auto& machine : machines) {
+        std::string tape;
+        machine.LoadFromString(RandomProgram(seed, tape));
+        tables.push_back(std::make_unique<TransitionTable>(machine));
+        jobs.push_back(BatchJob{ tables.back().get(), tape, 50 + static_cast<long long>(seed % 300) });
+    }
+
+    std::vector<BatchResult> expected = BatchRunner(8, 64).Run(jobs);
+    for (int lanes : { 12, 32 }) {
+        std::vector<BatchResult> results = BatchRunner(lanes, 48).Run(jobs);
+        for (size_t i = 0; i < jobs.size(); ++i) {
+            EXPECT_EQ(results[i].halted, expected[i].halted) << lanes << ' ' << i;
+            EXPECT_EQ(results[i].steps, expected[i].steps) << lanes << ' ' << i;
+            EXPECT_EQ(results[i].state, expected[i].state) << lanes << ' ' << i;
+            EXPECT_EQ(results[i].tape, expected[i].tape) << lanes << ' ' << i;
+        }
+    }
+}
+
+TEST(BatchRunnerTest, LongTapeFallsBackToScalar) {
+    TuringMachineLogic machine;
+    machine.LoadFromString("1\nS 1 0 R S\n");
+    TransitionTable table(machine);
+
+    std::vector<BatchJob> jobs{ BatchJob{ &table, std::string(1000, '1'), 0 } };
+    BatchRunner runner(8, 32);
+    std::vector<BatchResult> results = runner.Run(jobs);
+    EXPECT_TRUE(results[0].halted);
+    EXPECT_EQ(results[0].steps, 1000);
+    EXPECT_EQ(results[0].tape, std::string(1000, '0'));
+}
+
+TEST(BatchRunnerTest, NoRulesHaltsImmediately) {
+    TuringMachineLogic machine;
+    machine.LoadFromString("001\n");
+    TransitionTable table(machine);
+
+    std::vector<BatchJob> jobs{ BatchJob{ &table, "001", 0 } };
+    BatchRunner runner;
+    std::vector<BatchResult> results = runner.Run(jobs);
+    EXPECT_TRUE(results[0].halted);
+    EXPECT_EQ(results[0].steps, 0);
+    EXPECT_EQ(results[0].state, "");
+    EXPECT_EQ(results[0].tape, "001");
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
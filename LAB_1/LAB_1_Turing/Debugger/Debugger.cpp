@@ -0,0 +1,173 @@
+#include "Debugger.h"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <chrono>
+
+Debugger::Debugger(const TuringMachineLogic& machine)
+    : table(machine), tape(machine.GetTape().Clone()), state(table.GetStartState()), steps(0), resumeTransition(false){ }
+
+int Debugger::RequireState(const std::string& name) const{
+    int id = table.GetStateId(name);
+    if (id == TransitionTable::HALT)
+        throw std::invalid_argument(" : " + name);
+    return id;
+}
+
+void Debugger::BreakOnStateEntry(const std::string& name){
+    table.MarkStateEntry(RequireState(name));
+}
+
+void Debugger::BreakOnTransition(const std::string& name, char symbol){
+    table.SetFlag(RequireState(name), symbol, TransitionTable::BREAK_BEFORE);
+}
+
+void Debugger::BreakOnHeadPosition(long long position){
+    headBreakpoints.insert(position);
+}
+
+void Debugger::WatchCell(long long position){
+    watchedCells.insert(position);
+}
+
+void Debugger::ClearBreakpoints(){
+    table.ClearFlags();
+    headBreakpoints.clear();
+    watchedCells.clear();
+    resumeTransition = false;
+}
+
+long long Debugger::DistanceToBreakpoint() const{
+    long long head = tape->GetHeadPosition();
+    long long best = std::numeric_limits<long long>::max();
+    for (const std::set<long long>* points : { &headBreakpoints, &watchedCells }){
+        auto it = points->lower_bound(head);
+        if (it != points->end())
+            best = std::min(best, *it - head);
+        if (it != points->begin())
+            best = std::min(best, head - *std::prev(it));
+    }
+    return best;
+}
+
+void Debugger::Apply(const Transition& t){
+    tape->WriteSymbol(t.write);
+    if (t.move < 0)
+        tape->MoveLeft();
+    else if (t.move > 0)
+        tape->MoveRight();
+    state = t.next;
+    ++steps;
+}
+
+StopReason Debugger::Run(long long maxSteps){
+    const long long unlimited = std::numeric_limits<long long>::max();
+    long long remaining = maxSteps > 0 ? maxSteps : unlimited;
+
+    for (;;){
+        if (remaining == 0)
+            return StopReason::StepLimit;
+        if (state == TransitionTable::HALT)
+            return StopReason::Halted;
+
+        long long fast = remaining - 1;
+        if (!headBreakpoints.empty() || !watchedCells.empty())
+            fast = std::min(fast, std::max(0LL, DistanceToBreakpoint() - 1));
+
+        for (; fast > 0; --fast, --remaining){
+            const Transition& t = table.Get(state, tape->GetCurrentSymbol());
+            if (t.next == TransitionTable::HALT)
+                return StopReason::Halted;
+            if (t.flags)
+                break;
+            Apply(t);
+        }
+
+        const Transition& t = table.Get(state, tape->GetCurrentSymbol());
+        if (t.next == TransitionTable::HALT)
+            return StopReason::Halted;
+        if ((t.flags & TransitionTable::BREAK_BEFORE) && !resumeTransition){
+            resumeTransition = true;
+            return StopReason::Transition;
+        }
+        resumeTransition = false;
+
+        long long before = tape->GetHeadPosition();
+        bool written = watchedCells.count(before) != 0;
+        Apply(t);
+        --remaining;
+
+        if (written)
+            return StopReason::CellWrite;
+        if (t.flags & TransitionTable::BREAK_ENTRY)
+            return StopReason::StateEntry;
+        long long head = tape->GetHeadPosition();
+        if (head != before && headBreakpoints.count(head))
+            return StopReason::HeadPosition;
+    }
+}
+
+StopReason Debugger::Run(const RunLimits& limits, const std::atomic<bool>* cancel){
+    auto start = std::chrono::steady_clock::now();
+    long long interval = std::max(1LL, limits.checkInterval);
+    long long done = 0;
+    for (;;){
+        long long batch = interval;
+        if (limits.maxSteps > 0){
+            if (done >= limits.maxSteps)
+                return StopReason::StepLimit;
+            batch = std::min(batch, limits.maxSteps - done);
+        }
+
+        long long before = steps;
+        StopReason reason = Run(batch);
+        done += steps - before;
+        if (reason != StopReason::StepLimit)
+            return reason;
+
+        if (cancel && cancel->load(std::memory_order_relaxed))
+            return StopReason::Cancelled;
+        if (limits.maxTapeBytes > 0 && tape->MemoryUsage() > limits.maxTapeBytes)
+            return StopReason::MemoryLimit;
+        if (limits.maxMillis > 0){
+            auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+            if (elapsed.count() >= limits.maxMillis)
+                return StopReason::TimeLimit;
+        }
+    }
+}
+
+std::string Debugger::GetCurrentState() const{
+    return state == TransitionTable::HALT ? std::string() : table.GetStateName(state);
+}
+
+std::string Debugger::GetTapeString() const{
+    return tape->ToString();
+}
+
+char Debugger::GetCurrentSymbol() const{
+    return tape->GetCurrentSymbol();
+}
+
+long long Debugger::GetHeadPosition() const{
+    return tape->GetHeadPosition();
+}
+
+long long Debugger::GetSteps() const{
+    return steps;
+}
+
+const char* Debugger::ReasonName(StopReason reason){
+    switch (reason){
+    case StopReason::Halted: return "HALTED";
+    case StopReason::StepLimit: return "STEP_LIMIT";
+    case StopReason::StateEntry: return "STATE_ENTRY";
+    case StopReason::Transition: return "TRANSITION";
+    case StopReason::HeadPosition: return "HEAD_POSITION";
+    case StopReason::CellWrite: return "CELL_WRITE";
+    case StopReason::TimeLimit: return "TIME_LIMIT";
+    case StopReason::MemoryLimit: return "MEMORY_LIMIT";
+    case StopReason::Cancelled: return "CANCELLED";
+    }
+    return "UNKNOWN";
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include <string>
+#include <set>
+#include <memory>
+#include <atomic>
+#include "../TransitionTable/TransitionTable.h"
+
+enum class StopReason { Halted, StepLimit, StateEntry, Transition, HeadPosition, CellWrite, TimeLimit, MemoryLimit, Cancelled };
+
+class Debugger{
+private:
+    TransitionTable table;
+    std::unique_ptr<TapeBase> tape;
+    int state;
+    long long steps;
+    std::set<long long> headBreakpoints;
+    std::set<long long> watchedCells;
+    bool resumeTransition;
+
+    long long DistanceToBreakpoint() const;
+    void Apply(const Transition& t);
+    int RequireState(const std::string& name) const;
+
+public:
+    explicit Debugger(const TuringMachineLogic& machine);
+    void BreakOnStateEntry(const std::string& name);
+    void BreakOnTransition(const std::string& name, char symbol);
+    void BreakOnHeadPosition(long long position);
+    void WatchCell(long long position);
+    void ClearBreakpoints();
+
+    StopReason Run(long long maxSteps = 0);
+    StopReason Run(const RunLimits& limits, const std::atomic<bool>* cancel = nullptr);
+    std::string GetCurrentState() const;
+    std::string GetTapeString() const;
+    char GetCurrentSymbol() const;
+    long long GetHeadPosition() const;
+    long long GetSteps() const;
+
+    static const char* ReasonName(StopReason reason);
+    ~Debugger() = default;
+};
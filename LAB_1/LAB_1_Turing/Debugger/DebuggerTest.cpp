@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+#include <fstream>
+#include <cstdio>
+
+#include "Debugger.h"
+
+static TuringMachineLogic Load(const std::string& text) {
+    TuringMachineLogic machine;
+    machine.LoadFromString(text);
+    return machine;
+}
+
+TEST(DebuggerTest, RunsToHaltWithoutBreakpoints) {
+    Debugger debugger(Load("101\nS 1 0 R S\nS 0 1 R S\n"));
+    EXPECT_EQ(debugger.Run(), StopReason::Halted);
+    EXPECT_EQ(debugger.GetSteps(), 3);
+    EXPECT_EQ(debugger.GetTapeString(), "010");
+    EXPECT_EQ(debugger.GetCurrentState(), "S");
+    EXPECT_EQ(debugger.GetHeadPosition(), 3);
+}
+
+TEST(DebuggerTest, StepLimit) {
+    Debugger debugger(Load("_\nA _ 1 R A\n"));
+    EXPECT_EQ(debugger.Run(7), StopReason::StepLimit);
+    EXPECT_EQ(debugger.GetSteps(), 7);
+    EXPECT_EQ(debugger.Run(3), StopReason::StepLimit);
+    EXPECT_EQ(debugger.GetSteps(), 10);
+}
+
+TEST(DebuggerTest, RunLimitsStopRunWithoutBreakpointHit) {
+    Debugger debugger(Load("_\nA _ 1 R A\n"));
+    RunLimits limits;
+    limits.maxTapeBytes = 1000;
+    limits.checkInterval = 64;
+    EXPECT_EQ(debugger.Run(limits), StopReason::MemoryLimit);
+    EXPECT_GE(debugger.GetTapeString().size(), 1000u);
+
+    RunLimits timed;
+    timed.maxMillis = 5;
+    EXPECT_EQ(debugger.Run(timed), StopReason::TimeLimit);
+
+    std::atomic<bool> cancel(true);
+    RunLimits unlimited;
+    unlimited.checkInterval = 16;
+    long long before = debugger.GetSteps();
+    EXPECT_EQ(debugger.Run(unlimited, &cancel), StopReason::Cancelled);
+    EXPECT_EQ(debugger.GetSteps() - before, 16);
+
+    RunLimits counted;
+    counted.maxSteps = 10;
+    counted.checkInterval = 3;
+    before = debugger.GetSteps();
+    EXPECT_EQ(debugger.Run(counted), StopReason::StepLimit);
+    EXPECT_EQ(debugger.GetSteps() - before, 10);
+}
+
+TEST(DebuggerTest, BreakOnStateEntry) {
+    Debugger debugger(Load("1111\nA 1 1 R A\nA _ _ L B\nB 1 0 L B\n"));
+    debugger.BreakOnStateEntry("B");
+    EXPECT_EQ(debugger.Run(), StopReason::StateEntry);
+    EXPECT_EQ(debugger.GetSteps(), 5);
+    EXPECT_EQ(debugger.GetCurrentState(), "B");
+    EXPECT_EQ(debugger.GetHeadPosition(), 3);
+
+    EXPECT_EQ(debugger.Run(), StopReason::StateEntry);
+    EXPECT_EQ(debugger.GetSteps(), 6);
+}
+
+TEST(DebuggerTest, BreakBeforeTransitionAndResume) {
+    Debugger debugger(Load("110\nA 1 1 R A\nA 0 1 R A\n"));
+    debugger.BreakOnTransition("A", '0');
+    EXPECT_EQ(debugger.Run(), StopReason::Transition);
+    EXPECT_EQ(debugger.GetSteps(), 2);
+    EXPECT_EQ(debugger.GetCurrentSymbol(), '0');
+    EXPECT_EQ(debugger.GetTapeString(), "110");
+
+    EXPECT_EQ(debugger.Run(), StopReason::Halted);
+    EXPECT_EQ(debugger.GetTapeString(), "111");
+}
+
+TEST(DebuggerTest, BreakOnHeadPosition) {
+    Debugger debugger(Load("_\nA _ 1 R A\n"));
+    debugger.BreakOnHeadPosition(100);
+    debugger.BreakOnHeadPosition(-5);
+    EXPECT_EQ(debugger.Run(), StopReason::HeadPosition);
+    EXPECT_EQ(debugger.GetHeadPosition(), 100);
+    EXPECT_EQ(debugger.GetSteps(), 100);
+}
+
+TEST(DebuggerTest, WatchCellWrite) {
+    Debugger debugger(Load("_\nA _ 1 L A\n"));
+    debugger.WatchCell(-40);
+    EXPECT_EQ(debugger.Run(), StopReason::CellWrite);
+    EXPECT_EQ(debugger.GetSteps(), 41);
+    EXPECT_EQ(debugger.GetHeadPosition(), -41);
+    EXPECT_EQ(debugger.GetTapeString(), std::string(41, '1'));
+}
+
+TEST(DebuggerTest, ClearBreakpoints) {
+    Debugger debugger(Load("1111\nA 1 0 R A\n"));
+    debugger.BreakOnTransition("A", '1');
+    debugger.ClearBreakpoints();
+    EXPECT_EQ(debugger.Run(), StopReason::Halted);
+    EXPECT_EQ(debugger.GetTapeString(), "0000");
+}
+
+TEST(DebuggerTest, UnknownStateThrows) {
+    Debugger debugger(Load("1\nA 1 0 R A\n"));
+    EXPECT_THROW(debugger.BreakOnStateEntry("Z"), std::invalid_argument);
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
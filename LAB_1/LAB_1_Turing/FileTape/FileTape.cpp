@@ -0,0 +1,310 @@
+#include "FileTape.h"
+#include <stdexcept>
+#include <cstdio>
+#include <atomic>
+#include <algorithm>
+#include <iterator>
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+static size_t MappingGranularity(){
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return static_cast<size_t>(info.dwAllocationGranularity);
+#else
+    return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+}
+
+FileTape::FileTape(const std::string& initial, const std::string& scratchPath, size_t pageSize, size_t residentPages)
+    : path(scratchPath),
+#ifdef _WIN32
+      file(INVALID_HANDLE_VALUE),
+#else
+      fd(-1),
+#endif
+      pageCells(pageSize), slotBytes(0), maxResident(residentPages), nextSlot(0), minPage(0), maxPage(0),
+      current(nullptr), currentPage(0), offset(0){
+    if (pageCells == 0 || maxResident < 2)
+        throw std::invalid_argument("   ");
+
+    //        ,
+    //        
+    size_t granularity = MappingGranularity();
+    slotBytes = (pageCells + granularity - 1) / granularity * granularity;
+
+#ifdef _WIN32
+    file = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_TEMPORARY, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        throw std::runtime_error("    : " + path);
+#else
+    fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+    if (fd < 0)
+        throw std::runtime_error("    : " + path);
+#endif
+
+    try{
+        for (size_t start = 0; start < initial.size(); start += pageCells){
+            long long page = static_cast<long long>(start / pageCells);
+            size_t count = std::min(pageCells, initial.size() - start);
+            Frame& frame = Load(page);
+            std::copy(initial.begin() + start, initial.begin() + start + count, frame.cells);
+            maxPage = page;
+        }
+        Enter(0);
+    }
+    catch (...){
+        Release();
+        throw;
+    }
+}
+
+FileTape::~FileTape(){
+    Release();
+}
+
+void FileTape::Release(){
+    for (auto& frame : resident)
+        Unmap(frame.second.cells);
+    resident.clear();
+    lru.clear();
+    current = nullptr;
+#ifdef _WIN32
+    if (file != INVALID_HANDLE_VALUE)
+        CloseHandle(file);
+    file = INVALID_HANDLE_VALUE;
+#else
+    if (fd >= 0)
+        ::close(fd);
+    fd = -1;
+#endif
+    std::remove(path.c_str());
+}
+
+long long FileTape::SlotFor(long long page){
+    auto slot = slots.find(page);
+    if (slot != slots.end())
+        return slot->second;
+    long long id = nextSlot;
+#ifndef _WIN32
+    if (ftruncate(fd, static_cast<off_t>((id + 1) * static_cast<long long>(slotBytes))) != 0)
+        throw std::runtime_error("   : " + path);
+#endif
+    ++nextSlot;
+    slots.emplace(page, id);
+    return id;
+}
+
+char* FileTape::MapSlot(long long slot) const{
+    unsigned long long start = static_cast<unsigned long long>(slot) * slotBytes;
+    void* view = nullptr;
+#ifdef _WIN32
+    //         
+    unsigned long long end = start + slotBytes;
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READWRITE, static_cast<DWORD>(end >> 32), static_cast<DWORD>(end), nullptr);
+    if (mapping){
+        view = MapViewOfFile(mapping, FILE_MAP_WRITE, static_cast<DWORD>(start >> 32), static_cast<DWORD>(start), slotBytes);
+        CloseHandle(mapping);
+    }
+#else
+    view = mmap(nullptr, slotBytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, static_cast<off_t>(start));
+    if (view == MAP_FAILED)
+        view = nullptr;
+#endif
+    if (!view)
+        throw std::runtime_error("      : " + path);
+    return static_cast<char*>(view);
+}
+
+void FileTape::Unmap(char* view) const{
+#ifdef _WIN32
+    UnmapViewOfFile(view);
+#else
+    munmap(view, slotBytes);
+#endif
+}
+
+//     :   ,
+//    ; nullptr,    
+void FileTape::PeekPage(long long page, const std::function<void(const char*)>& use) const{
+    auto frame = resident.find(page);
+    if (frame != resident.end()){
+        use(frame->second.cells);
+        return;
+    }
+    auto slot = slots.find(page);
+    if (slot == slots.end()){
+        use(nullptr);
+        return;
+    }
+    char* view = MapSlot(slot->second);
+    try{
+        use(view);
+    }
+    catch (...){
+        Unmap(view);
+        throw;
+    }
+    Unmap(view);
+}
+
+void FileTape::Evict(){
+    long long victim = lru.back();
+    lru.pop_back();
+    auto frame = resident.find(victim);
+    Unmap(frame->second.cells);
+    resident.erase(frame);
+}
+
+FileTape::Frame& FileTape::Load(long long page){
+    auto found = resident.find(page);
+    if (found != resident.end()){
+        lru.splice(lru.begin(), lru, found->second.lru);
+        return found->second;
+    }
+
+    while (resident.size() >= maxResident)
+        Evict();
+
+    bool fresh = slots.find(page) == slots.end();
+    char* cells = MapSlot(SlotFor(page));
+    if (fresh)
+        std::fill(cells, cells + pageCells, BLANK);
+
+    lru.push_front(page);
+    Frame& frame = resident[page];
+    frame.cells = cells;
+    frame.lru = lru.begin();
+    return frame;
+}
+
+void FileTape::Prefetch(long long page){
+    if (resident.count(page) || !slots.count(page))
+        return;
+    Frame& frame = Load(page);
+#ifdef _WIN32
+    WIN32_MEMORY_RANGE_ENTRY range{ frame.cells, pageCells };
+    PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+#else
+    madvise(frame.cells, pageCells, MADV_WILLNEED);
+#endif
+    lru.splice(lru.begin(), lru, current->lru);
+}
+
+void FileTape::Enter(long long page){
+    long long direction = page - currentPage;
+    current = &Load(page);
+    currentPage = page;
+    minPage = std::min(minPage, page);
+    maxPage = std::max(maxPage, page);
+    if (direction != 0)
+        Prefetch(page + direction);
+}
+
+char FileTape::GetCurrentSymbol() const{
+    return current->cells[offset];
+}
+
+void FileTape::WriteSymbol(char symbol){
+    current->cells[offset] = symbol;
+}
+
+void FileTape::MoveLeft(){
+    if (offset == 0){
+        Enter(currentPage - 1);
+        offset = static_cast<long long>(pageCells) - 1;
+    }
+    else
+        --offset;
+}
+
+void FileTape::MoveRight(){
+    if (offset + 1 == static_cast<long long>(pageCells)){
+        Enter(currentPage + 1);
+        offset = 0;
+    }
+    else
+        ++offset;
+}
+
+std::string FileTape::ToString() const{
+    auto notBlank = [](char c){ return c != BLANK; };
+
+    //     ,      
+    long long leftPage = minPage;
+    size_t left = pageCells;
+    for (; leftPage <= maxPage && left == pageCells; ++leftPage)
+        PeekPage(leftPage, [&](const char* cells){
+            if (cells)
+                left = static_cast<size_t>(std::find_if(cells, cells + pageCells, notBlank) - cells);
+        });
+    if (left == pageCells)
+        return std::string(1, BLANK);
+    --leftPage;
+
+    long long rightPage = maxPage;
+    size_t right = pageCells;
+    for (; right == pageCells; --rightPage)
+        PeekPage(rightPage, [&](const char* cells){
+            if (!cells)
+                return;
+            auto last = std::find_if(std::reverse_iterator<const char*>(cells + pageCells), std::reverse_iterator<const char*>(cells), notBlank);
+            if (last.base() != cells)
+                right = static_cast<size_t>(last.base() - cells) - 1;
+        });
+    ++rightPage;
+
+    std::string out;
+    out.reserve(static_cast<size_t>(rightPage - leftPage) * pageCells + right - left + 1);
+    for (long long page = leftPage; page <= rightPage; ++page){
+        size_t from = page == leftPage ? left : 0;
+        size_t to = page == rightPage ? right + 1 : pageCells;
+        PeekPage(page, [&](const char* cells){
+            if (cells)
+                out.append(cells + from, cells + to);
+            else
+                out.append(to - from, BLANK);
+        });
+    }
+    return out;
+}
+
+size_t FileTape::MemoryUsage() const{
+    //    ,     
+    return resident.size() * slotBytes;
+}
+
+long long FileTape::GetHeadPosition() const{
+    return currentPage * static_cast<long long>(pageCells) + offset;
+}
+
+size_t FileTape::GetResidentPages() const{
+    return resident.size();
+}
+
+std::string FileTape::UniquePath(const std::string& base){
+    static std::atomic<int> counter(0);
+    return base + "." + std::to_string(++counter);
+}
+
+std::unique_ptr<TapeBase> FileTape::Clone() const{
+    auto copy = std::make_unique<FileTape>(std::string(), UniquePath(path), pageCells, maxResident);
+    for (long long page = minPage; page <= maxPage; ++page)
+        PeekPage(page, [&](const char* cells){
+            if (cells && std::any_of(cells, cells + pageCells, [](char c){ return c != BLANK; }))
+                std::copy(cells, cells + pageCells, copy->Load(page).cells);
+        });
+    copy->minPage = minPage;
+    copy->maxPage = maxPage;
+    copy->currentPage = currentPage;
+    copy->current = &copy->Load(currentPage);
+    copy->offset = offset;
+    return copy;
+}
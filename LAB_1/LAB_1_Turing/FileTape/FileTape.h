@@ -0,0 +1,64 @@
+#pragma once
+#include <string>
+#include <list>
+#include <unordered_map>
+#include <cstddef>
+#include <functional>
+#include "../Tape/TapeBase.h"
+
+class FileTape : public TapeBase{
+private:
+    struct Frame{
+        char* cells;
+        std::list<long long>::iterator lru;
+    };
+
+    std::string path;
+#ifdef _WIN32
+    void* file;
+#else
+    int fd;
+#endif
+    size_t pageCells;
+    size_t slotBytes;
+    size_t maxResident;
+
+    std::unordered_map<long long, Frame> resident;
+    std::list<long long> lru;
+    std::unordered_map<long long, long long> slots;
+    long long nextSlot;
+    long long minPage;
+    long long maxPage;
+
+    Frame* current;
+    long long currentPage;
+    long long offset;
+
+    long long SlotFor(long long page);
+    char* MapSlot(long long slot) const;
+    void Unmap(char* view) const;
+    void PeekPage(long long page, const std::function<void(const char*)>& use) const;
+    void Evict();
+    Frame& Load(long long page);
+    void Enter(long long page);
+    void Prefetch(long long page);
+    void Release();
+
+public:
+    FileTape() = delete;
+    FileTape(const std::string& initial, const std::string& scratchPath, size_t pageSize = 65536, size_t residentPages = 64);
+    FileTape(const FileTape&) = delete;
+    FileTape& operator=(const FileTape&) = delete;
+
+    char GetCurrentSymbol() const override;
+    void WriteSymbol(char symbol) override;
+    void MoveLeft() override;
+    void MoveRight() override;
+    std::string ToString() const override;
+    size_t MemoryUsage() const override;
+    long long GetHeadPosition() const override;
+    std::unique_ptr<TapeBase> Clone() const override;
+    size_t GetResidentPages() const;
+    static std::string UniquePath(const std::string& base);
+    ~FileTape();
+};
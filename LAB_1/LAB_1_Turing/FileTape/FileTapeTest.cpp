@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+#include <fstream>
+#include <cstdio>
+
+#include "FileTape.h"
+
+static bool FileExists(const std::string& name) {
+    std::ifstream in(name);
+    return static_cast<bool>(in);
+}
+
+TEST(FileTapeTest, InitializationAndCurrentSymbol) {
+    FileTape tape("ABC", "test_filetape_init.swp", 4, 2);
+    EXPECT_EQ(tape.GetCurrentSymbol(), 'A');
+    EXPECT_EQ(tape.ToString(), "ABC");
+}
+
+TEST(FileTapeTest, InvalidParametersThrow) {
+    EXPECT_THROW(FileTape("A", "test_filetape_bad.swp", 0, 2), std::invalid_argument);
+    EXPECT_THROW(FileTape("A", "test_filetape_bad.swp", 4, 1), std::invalid_argument);
+}
+
+TEST(FileTapeTest, MoveLeftBeyondStart) {
+    FileTape tape("G", "test_filetape_left.swp", 4, 2);
+    tape.MoveLeft();
+    EXPECT_EQ(tape.GetCurrentSymbol(), '_');
+    EXPECT_EQ(tape.GetHeadPosition(), -1);
+    tape.WriteSymbol('H');
+    EXPECT_EQ(tape.ToString(), "HG");
+}
+
+TEST(FileTapeTest, ScratchFileRemovedOnDestruction) {
+    {
+        FileTape tape("1", "test_filetape_remove.swp", 4, 2);
+        EXPECT_TRUE(FileExists("test_filetape_remove.swp"));
+    }
+    EXPECT_FALSE(FileExists("test_filetape_remove.swp"));
+}
+
+TEST(FileTapeTest, ResidentPagesAreBounded) {
+    FileTape tape("", "test_filetape_bounded.swp", 8, 3);
+    for (int i = 0; i < 200; ++i) {
+        tape.WriteSymbol(static_cast<char>('a' + i % 26));
+        tape.MoveRight();
+    }
+    EXPECT_LE(tape.GetResidentPages(), 3u);
+    //        ( 64   Windows)
+    EXPECT_GE(tape.MemoryUsage(), tape.GetResidentPages() * 8);
+    EXPECT_LE(tape.MemoryUsage(), 3u * 65536u);
+    EXPECT_EQ(tape.MemoryUsage() % tape.GetResidentPages(), 0u);
+
+    std::string expected;
+    for (int i = 0; i < 200; ++i)
+        expected.push_back(static_cast<char>('a' + i % 26));
+    EXPECT_EQ(tape.ToString(), expected);
+
+    for (int i = 0; i < 200; ++i)
+        tape.MoveLeft();
+    EXPECT_EQ(tape.GetCurrentSymbol(), 'a');
+}
+
+TEST(FileTapeTest, MatchesPlainTapeOnRandomWalk) {
+    FileTape tape("", "test_filetape_walk.swp", 16, 2);
+    std::string expected(1, '_');
+    size_t head = 0;
+    unsigned seed = 777;
+    for (int i = 0; i < 20000; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        unsigned r = (seed >> 16) % 5;
+        if (r == 0) {
+            char c = static_cast<char>('0' + (seed >> 8) % 10);
+            tape.WriteSymbol(c);
+            expected[head] = c;
+        }
+        else if (r < 3) {
+            tape.MoveLeft();
+            if (head == 0)
+                expected.insert(expected.begin(), '_');
+            else
+                --head;
+        }
+        else {
+            tape.MoveRight();
+            if (++head == expected.size())
+                expected.push_back('_');
+        }
+        ASSERT_EQ(tape.GetCurrentSymbol(), expected[head]);
+    }
+    size_t l = expected.find_first_not_of('_');
+    size_t r = expected.find_last_not_of('_');
+    EXPECT_EQ(tape.ToString(), l == std::string::npos ? "_" : expected.substr(l, r - l + 1));
+}
+
+TEST(FileTapeTest, ToStringSkipsBlankEdgePages) {
+    FileTape tape("", "test_filetape_edges.swp", 4, 2);
+    EXPECT_EQ(tape.ToString(), "_");
+    for (int i = 0; i < 30; ++i)
+        tape.MoveRight();
+    tape.WriteSymbol('x');
+    for (int i = 0; i < 39; ++i)
+        tape.MoveLeft();
+    tape.WriteSymbol('y');
+    for (int i = 0; i < 20; ++i)
+        tape.MoveLeft();
+    EXPECT_EQ(tape.ToString(), "y" + std::string(38, '_') + "x");
+}
+
+TEST(FileTapeTest, CloneIsIndependent) {
+    FileTape tape("1234567890", "test_filetape_clone.swp", 4, 2);
+    for (int i = 0; i < 6; ++i)
+        tape.MoveRight();
+    std::unique_ptr<TapeBase> copy = tape.Clone();
+    EXPECT_EQ(copy->GetCurrentSymbol(), '7');
+    copy->WriteSymbol('x');
+    EXPECT_EQ(copy->ToString(), "123456x890");
+    EXPECT_EQ(tape.ToString(), "1234567890");
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
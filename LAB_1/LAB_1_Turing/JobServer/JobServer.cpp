@@ -0,0 +1,206 @@
+#include "JobServer.h"
+#include <sstream>
+#include <iomanip>
+#include <stdexcept>
+
+JobServer::Program::Program(const TuringMachineLogic& loaded) : machine(loaded), table(machine){ }
+
+JobServer::JobServer(std::ostream& output, unsigned threads, const RunLimits& limits)
+    : out(output), defaultLimits(limits), cancelled(false), stopping(false), busy(0){
+    if (threads == 0)
+        threads = std::thread::hardware_concurrency();
+    if (threads == 0)
+        threads = 1;
+    for (unsigned i = 0; i < threads; ++i)
+        workers.emplace_back(&JobServer::WorkerLoop, this);
+}
+
+JobServer::~JobServer(){
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        stopping = true;
+    }
+    cancelled = true;
+    queueCv.notify_all();
+    for (auto& w : workers)
+        w.join();
+}
+
+uint64_t JobServer::HashProgram(const std::string& text){
+    uint64_t hash = 1469598103934665603ULL;
+    for (char c : text){
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+std::string JobServer::HashToString(uint64_t hash){
+    std::ostringstream oss;
+    oss << std::hex << std::setw(16) << std::setfill('0') << hash;
+    return oss.str();
+}
+
+uint64_t JobServer::AddProgram(const std::string& text){
+    uint64_t hash = HashProgram(text);
+    {
+        std::lock_guard<std::mutex> lock(programsMutex);
+        if (programs.count(hash))
+            return hash;
+    }
+    TuringMachineLogic machine;
+    machine.LoadFromString(text);
+    auto program = std::make_shared<const Program>(machine);
+
+    std::lock_guard<std::mutex> lock(programsMutex);
+    programs.emplace(hash, std::move(program));
+    return hash;
+}
+
+std::shared_ptr<const JobServer::Program> JobServer::FindProgram(uint64_t hash){
+    std::lock_guard<std::mutex> lock(programsMutex);
+    auto it = programs.find(hash);
+    if (it == programs.end())
+        return nullptr;
+    return it->second;
+}
+
+bool JobServer::Submit(const std::string& jobId, uint64_t programHash, long long maxSteps, const std::string& tape){
+    auto program = FindProgram(programHash);
+    if (!program)
+        return false;
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        RunLimits limits = defaultLimits;
+        if (maxSteps > 0 && (limits.maxSteps <= 0 || maxSteps < limits.maxSteps))
+            limits.maxSteps = maxSteps;
+        queue.push_back(Job{ jobId, std::move(program), limits, tape });
+    }
+    queueCv.notify_one();
+    return true;
+}
+
+void JobServer::Drain(){
+    std::unique_lock<std::mutex> lock(queueMutex);
+    queueCv.wait(lock, [this]{ return queue.empty() && busy == 0; });
+}
+
+void JobServer::WorkerLoop(){
+    for (;;){
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(queueMutex);
+            queueCv.wait(lock, [this]{ return stopping || !queue.empty(); });
+            if (queue.empty())
+                return;
+            job = std::move(queue.front());
+            queue.pop_front();
+            ++busy;
+        }
+        Execute(job);
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            --busy;
+        }
+        queueCv.notify_all();
+    }
+}
+
+void JobServer::Execute(const Job& job){
+    //         ,       
+    std::unique_ptr<TapeBase> tape = job.program->machine.CreateTape(job.tape);
+    const TransitionTable& table = job.program->table;
+    RunResult result = table.Run(table.GetStartState(), *tape, job.limits, &cancelled);
+
+    std::ostringstream header;
+    header << "RESULT " << job.id << ' ' << TuringMachineLogic::StatusName(result.status) << ' ' << result.steps << ' '
+        << (result.state.empty() ? "-" : result.state) << ' ' << result.tape.size();
+    WriteFrame(header.str(), result.tape);
+}
+
+void JobServer::WriteFrame(const std::string& header, const std::string& payload){
+    std::lock_guard<std::mutex> lock(outMutex);
+    out << header << '\n' << payload << '\n';
+    out.flush();
+}
+
+static bool ReadPayload(std::istream& in, size_t size, std::string& payload){
+    payload.assign(size, '\0');
+    if (size > 0 && !in.read(&payload[0], static_cast<std::streamsize>(size)))
+        return false;
+    return true;
+}
+
+bool JobServer::HandleRequest(const std::string& line, std::istream& in){
+    std::istringstream iss(line);
+    std::string command;
+    iss >> command;
+
+    if (command == "QUIT")
+        return false;
+
+    if (command == "PROGRAM"){
+        size_t size = 0;
+        std::string text;
+        if (!(iss >> size) || !ReadPayload(in, size, text)){
+            WriteFrame("ERROR -   PROGRAM", "");
+            return false;
+        }
+        try{
+            WriteFrame("PROGRAM " + HashToString(AddProgram(text)), "");
+        }
+        catch (const std::exception& ex){
+            WriteFrame(std::string("ERROR - ") + ex.what(), "");
+        }
+        return true;
+    }
+
+    if (command == "RUN"){
+        std::string jobId, programRef;
+        long long maxSteps = 0;
+        size_t tapeSize = 0;
+        std::string tape;
+        if (!(iss >> jobId >> programRef >> maxSteps >> tapeSize) || !ReadPayload(in, tapeSize, tape)){
+            WriteFrame("ERROR -   RUN", "");
+            return false;
+        }
+
+        uint64_t hash = 0;
+        if (programRef == "-"){
+            size_t programSize = 0;
+            std::string text;
+            if (!(iss >> programSize) || !ReadPayload(in, programSize, text)){
+                WriteFrame("ERROR " + jobId + "   ", "");
+                return false;
+            }
+            hash = AddProgram(text);
+        }
+        else{
+            std::istringstream hex(programRef);
+            if (!(hex >> std::hex >> hash)){
+                WriteFrame("ERROR " + jobId + "   ", "");
+                return true;
+            }
+        }
+
+        if (!Submit(jobId, hash, maxSteps, tape))
+            WriteFrame("ERROR " + jobId + "  : " + programRef, "");
+        return true;
+    }
+
+    WriteFrame("ERROR -  : " + command, "");
+    return true;
+}
+
+void JobServer::Serve(std::istream& in){
+    std::string line;
+    while (std::getline(in, line)){
+        if (!line.empty() && line.back() == '\r')
+            line.pop_back();
+        if (line.empty())
+            continue;
+        if (!HandleRequest(line, in))
+            break;
+    }
+    Drain();
+}
@@ -0,0 +1,66 @@
+#pragma once
+#include <string>
+#include <deque>
+#include <vector>
+#include <memory>
+#include <unordered_map>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <istream>
+#include <ostream>
+#include <cstdint>
+#include <atomic>
+#include "../TuringMachineLogic/TuringMachineLogic.h"
+#include "../TransitionTable/TransitionTable.h"
+
+class JobServer{
+private:
+    struct Program{
+        TuringMachineLogic machine;
+        TransitionTable table;
+        explicit Program(const TuringMachineLogic& loaded);
+    };
+
+    struct Job{
+        std::string id;
+        std::shared_ptr<const Program> program;
+        RunLimits limits;
+        std::string tape;
+    };
+
+    std::ostream& out;
+    RunLimits defaultLimits;
+    std::atomic<bool> cancelled;
+    std::mutex outMutex;
+
+    std::unordered_map<uint64_t, std::shared_ptr<const Program>> programs;
+    std::mutex programsMutex;
+
+    std::deque<Job> queue;
+    std::mutex queueMutex;
+    std::condition_variable queueCv;
+    bool stopping;
+    int busy;
+    std::vector<std::thread> workers;
+
+    void WorkerLoop();
+    void Execute(const Job& job);
+    void WriteFrame(const std::string& header, const std::string& payload);
+    std::shared_ptr<const Program> FindProgram(uint64_t hash);
+    bool HandleRequest(const std::string& line, std::istream& in);
+
+public:
+    JobServer(std::ostream& output, unsigned threads = 0, const RunLimits& limits = RunLimits());
+    JobServer(const JobServer&) = delete;
+    JobServer& operator=(const JobServer&) = delete;
+
+    uint64_t AddProgram(const std::string& text);
+    bool Submit(const std::string& jobId, uint64_t programHash, long long maxSteps, const std::string& tape);
+    void Serve(std::istream& in);
+    void Drain();
+
+    static uint64_t HashProgram(const std::string& text);
+    static std::string HashToString(uint64_t hash);
+    ~JobServer();
+};
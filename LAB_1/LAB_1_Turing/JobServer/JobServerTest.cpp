@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <map>
+#include <vector>
+
+#include "JobServer.h"
+
+static std::map<std::string, std::string> ParseResults(const std::string& output) {
+    std::map<std::string, std::string> results;
+    std::istringstream in(output);
+    std::string line;
+    while (std::getline(in, line)) {
+        std::istringstream iss(line);
+        std::string tag, id;
+        iss >> tag >> id;
+        if (tag != "RESULT")
+            continue;
+        std::string tape;
+        std::getline(in, tape);
+        results[id] = line + "|" + tape;
+    }
+    return results;
+}
+
+TEST(JobServerTest, HashIsStable) {
+    EXPECT_EQ(JobServer::HashProgram("abc"), JobServer::HashProgram("abc"));
+    EXPECT_NE(JobServer::HashProgram("abc"), JobServer::HashProgram("abd"));
+    EXPECT_EQ(JobServer::HashToString(255), "00000000000000ff");
+}
+
+TEST(JobServerTest, ProgramIsCachedByHash) {
+    std::ostringstream out;
+    JobServer server(out, 1);
+    std::string text = "101\nS 1 0 R S\nS 0 1 R S\n";
+    uint64_t first = server.AddProgram(text);
+    uint64_t second = server.AddProgram(text);
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(first, JobServer::HashProgram(text));
+}
+
+TEST(JobServerTest, RunsJobsFromStream) {
+    std::string program = "1\nS 1 0 R S\nS 0 1 R S\n";
+    std::string hash = JobServer::HashToString(JobServer::HashProgram(program));
+    std::ostringstream request;
+    request << "PROGRAM " << program.size() << "\n" << program
+        << "RUN a " << hash << " 0 3\n101\n"
+        << "RUN b " << hash << " 0 2\n11\n"
+        << "QUIT\n";
+
+    std::istringstream in(request.str());
+    std::ostringstream out;
+    {
+        JobServer server(out, 2);
+        server.Serve(in);
+    }
+
+    auto results = ParseResults(out.str());
+    ASSERT_EQ(results.size(), 2u);
+    EXPECT_EQ(results["a"], "RESULT a HALTED 3 S 3|010");
+    EXPECT_EQ(results["b"], "RESULT b HALTED 2 S 2|00");
+    EXPECT_NE(out.str().find("PROGRAM " + hash), std::string::npos);
+}
+
+TEST(JobServerTest, InlineProgramAndStepLimit) {
+    std::string program = "_\nA _ 1 R A\n";
+    std::ostringstream request;
+    request << "RUN loop - 5 0 " << program.size() << "\n" << program;
+
+    std::istringstream in(request.str());
+    std::ostringstream out;
+    {
+        JobServer server(out, 1);
+        server.Serve(in);
+    }
+
+    auto results = ParseResults(out.str());
+    EXPECT_EQ(results["loop"], "RESULT loop STEP_LIMIT 5 A 5|11111");
+}
+
+TEST(JobServerTest, ServerLimitsCapJobs) {
+    RunLimits limits;
+    limits.maxSteps = 3;
+    std::string program = "_\nA _ 1 R A\n";
+    std::ostringstream request;
+    request << "RUN capped - 100 0 " << program.size() << "\n" << program;
+
+    std::istringstream in(request.str());
+    std::ostringstream out;
+    {
+        JobServer server(out, 1, limits);
+        server.Serve(in);
+    }
+
+    auto results = ParseResults(out.str());
+    EXPECT_EQ(results["capped"], "RESULT capped STEP_LIMIT 3 A 3|111");
+}
+
+TEST(JobServerTest, CompiledRunMatchesInterpreter) {
+    std::string program = "_\nR 0 0 R R\nR 1 1 R R\nR _ _ L C\nC 1 0 L C\nC 0 1 L D\nC _ 1 L D\n";
+    std::string hash = JobServer::HashToString(JobServer::HashProgram(program));
+    std::vector<std::string> tapes = { "1011", "111", "0", "" };
+    std::ostringstream request;
+    request << "PROGRAM " << program.size() << "\n" << program;
+    for (size_t n = 0; n < tapes.size(); ++n)
+        request << "RUN j" << n << ' ' << hash << " 0 " << tapes[n].size() << "\n" << tapes[n] << "\n";
+
+    std::istringstream in(request.str());
+    std::ostringstream out;
+    {
+        JobServer server(out, 2);
+        server.Serve(in);
+    }
+
+    auto results = ParseResults(out.str());
+    ASSERT_EQ(results.size(), tapes.size());
+    for (size_t n = 0; n < tapes.size(); ++n) {
+        TuringMachineLogic machine;
+        machine.LoadFromString(program);
+        machine.SetTape(tapes[n]);
+        RunResult expected = machine.Run(RunLimits());
+        std::ostringstream line;
+        line << "RESULT j" << n << ' ' << TuringMachineLogic::StatusName(expected.status) << ' ' << expected.steps << ' '
+            << expected.state << ' ' << expected.tape.size() << '|' << expected.tape;
+        EXPECT_EQ(results["j" + std::to_string(n)], line.str());
+    }
+}
+
+TEST(JobServerTest, UnknownProgramReportsError) {
+    std::istringstream in("RUN x 0123456789abcdef 0 1\n1\n");
+    std::ostringstream out;
+    {
+        JobServer server(out, 1);
+        server.Serve(in);
+    }
+    EXPECT_EQ(out.str().rfind("ERROR x", 0), 0u);
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,137 @@
+#include "PackedTape.h"
+#include <stdexcept>
+
+PackedTape::PackedTape(const std::string& initial, const std::string& alphabet) : headIndex(0), origin(0){
+    symbols.push_back(BLANK);
+    for (const std::string* source : { &alphabet, &initial })
+        for (char c : *source)
+            if (symbols.find(c) == std::string::npos)
+                symbols.push_back(c);
+    if (symbols.size() > MAX_SYMBOLS)
+        throw std::invalid_argument("     ");
+
+    bitsPerCell = (symbols.size() <= 2) ? 1 : 2;
+    cellsPerWord = 64 / bitsPerCell;
+    cellMask = (uint64_t(1) << bitsPerCell) - 1;
+
+    codes.fill(-1);
+    for (size_t i = 0; i < symbols.size(); ++i)
+        codes[static_cast<unsigned char>(symbols[i])] = static_cast<signed char>(i);
+
+    int cellsPerByte = 8 / bitsPerCell;
+    decodeTable.resize(256 * cellsPerByte);
+    for (int b = 0; b < 256; ++b)
+        for (int c = 0; c < cellsPerByte; ++c){
+            unsigned code = (b >> (c * bitsPerCell)) & cellMask;
+            decodeTable[b * cellsPerByte + c] = code < symbols.size() ? symbols[code] : BLANK;
+        }
+
+    words.assign(initial.size() / cellsPerWord + 1, 0);
+    for (size_t i = 0; i < initial.size(); ++i)
+        SetCode(i, Encode(initial[i]));
+}
+
+bool PackedTape::Fits(const std::string& alphabet){
+    std::string distinct(1, BLANK);
+    for (char c : alphabet)
+        if (distinct.find(c) == std::string::npos)
+            distinct.push_back(c);
+    return distinct.size() <= MAX_SYMBOLS;
+}
+
+unsigned PackedTape::Encode(char symbol) const{
+    signed char code = codes[static_cast<unsigned char>(symbol)];
+    if (code < 0)
+        throw std::logic_error(std::string("    : ") + symbol);
+    return static_cast<unsigned>(code);
+}
+
+unsigned PackedTape::GetCode(size_t index) const{
+    int shift = static_cast<int>(index % cellsPerWord) * bitsPerCell;
+    return static_cast<unsigned>((words[index / cellsPerWord] >> shift) & cellMask);
+}
+
+void PackedTape::SetCode(size_t index, unsigned code){
+    int shift = static_cast<int>(index % cellsPerWord) * bitsPerCell;
+    uint64_t& word = words[index / cellsPerWord];
+    word = (word & ~(cellMask << shift)) | (uint64_t(code) << shift);
+}
+
+char PackedTape::GetCurrentSymbol() const{
+    return symbols[GetCode(headIndex)];
+}
+
+void PackedTape::WriteSymbol(char symbol){
+    SetCode(headIndex, Encode(symbol));
+}
+
+void PackedTape::GrowLeft(){
+    size_t added = words.size();
+    words.insert(words.begin(), added, 0);
+    headIndex += added * cellsPerWord;
+    origin += added * cellsPerWord;
+}
+
+void PackedTape::MoveLeft(){
+    if (headIndex == 0)
+        GrowLeft();
+    --headIndex;
+}
+
+void PackedTape::MoveRight(){
+    ++headIndex;
+    if (headIndex == words.size() * cellsPerWord)
+        words.push_back(0);
+}
+
+std::string PackedTape::ToString() const{
+    size_t first = 0;
+    while (first < words.size() && words[first] == 0)
+        ++first;
+    if (first == words.size())
+        return std::string(1, BLANK);
+    size_t last = words.size() - 1;
+    while (words[last] == 0)
+        --last;
+
+    size_t left = first * cellsPerWord;
+    while (GetCode(left) == 0)
+        ++left;
+    size_t right = last * cellsPerWord + cellsPerWord - 1;
+    while (GetCode(right) == 0)
+        --right;
+
+    size_t cellsPerByte = 8 / bitsPerCell;
+    std::string out;
+    out.reserve(right - left + 1);
+    size_t i = left;
+    while (i <= right){
+        if (i % cellsPerByte == 0 && right - i + 1 >= cellsPerByte){
+            size_t byteIndex = (i % cellsPerWord) / cellsPerByte;
+            unsigned byte = static_cast<unsigned>((words[i / cellsPerWord] >> (byteIndex * 8)) & 0xFF);
+            out.append(&decodeTable[byte * cellsPerByte], cellsPerByte);
+            i += cellsPerByte;
+        }
+        else{
+            out.push_back(symbols[GetCode(i)]);
+            ++i;
+        }
+    }
+    return out;
+}
+
+size_t PackedTape::MemoryUsage() const{
+    return words.size() * sizeof(uint64_t);
+}
+
+std::unique_ptr<TapeBase> PackedTape::Clone() const{
+    return std::make_unique<PackedTape>(*this);
+}
+
+long long PackedTape::GetHeadPosition() const{
+    return static_cast<long long>(headIndex) - static_cast<long long>(origin);
+}
+
+int PackedTape::GetBitsPerCell() const{
+    return bitsPerCell;
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <array>
+#include <cstdint>
+#include "../Tape/TapeBase.h"
+
+class PackedTape : public TapeBase{
+private:
+    std::vector<uint64_t> words;
+    std::string symbols;
+    std::array<signed char, 256> codes;
+    std::string decodeTable;
+    int bitsPerCell;
+    int cellsPerWord;
+    uint64_t cellMask;
+    size_t headIndex;
+    size_t origin;
+
+    unsigned GetCode(size_t index) const;
+    void SetCode(size_t index, unsigned code);
+    unsigned Encode(char symbol) const;
+    void GrowLeft();
+
+public:
+    static constexpr size_t MAX_SYMBOLS = 4;
+
+    PackedTape() = delete;
+    PackedTape(const std::string& initial, const std::string& alphabet);
+    char GetCurrentSymbol() const override;
+    void WriteSymbol(char symbol) override;
+    void MoveLeft() override;
+    void MoveRight() override;
+    std::string ToString() const override;
+    size_t MemoryUsage() const override;
+    long long GetHeadPosition() const override;
+    std::unique_ptr<TapeBase> Clone() const override;
+    int GetBitsPerCell() const;
+
+    static bool Fits(const std::string& alphabet);
+    ~PackedTape() = default;
+};
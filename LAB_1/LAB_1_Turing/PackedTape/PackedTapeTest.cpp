@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+#include <fstream>
+#include <cstdio>
+
+#include "PackedTape.h"
+
+TEST(PackedTapeTest, FitsSmallAlphabets) {
+    EXPECT_TRUE(PackedTape::Fits("01"));
+    EXPECT_TRUE(PackedTape::Fits("_1"));
+    EXPECT_TRUE(PackedTape::Fits("012"));
+    EXPECT_FALSE(PackedTape::Fits("0123"));
+    EXPECT_FALSE(PackedTape::Fits("abcde"));
+}
+
+TEST(PackedTapeTest, OneBitForBinaryAlphabet) {
+    PackedTape tape("1", "1");
+    EXPECT_EQ(tape.GetBitsPerCell(), 1);
+    EXPECT_EQ(tape.GetCurrentSymbol(), '1');
+    EXPECT_EQ(tape.ToString(), "1");
+}
+
+TEST(PackedTapeTest, TwoBitsForFourSymbols) {
+    PackedTape tape("102", "012");
+    EXPECT_EQ(tape.GetBitsPerCell(), 2);
+    EXPECT_EQ(tape.ToString(), "102");
+    tape.MoveRight();
+    tape.MoveRight();
+    EXPECT_EQ(tape.GetCurrentSymbol(), '2');
+}
+
+TEST(PackedTapeTest, TooManySymbolsThrows) {
+    EXPECT_THROW(PackedTape("0123", ""), std::invalid_argument);
+}
+
+TEST(PackedTapeTest, WriteOutsideAlphabetThrows) {
+    PackedTape tape("1", "");
+    EXPECT_THROW(tape.WriteSymbol('x'), std::logic_error);
+}
+
+TEST(PackedTapeTest, MoveLeftBeyondStart) {
+    PackedTape tape("1", "1");
+    tape.MoveLeft();
+    EXPECT_EQ(tape.GetCurrentSymbol(), '_');
+    EXPECT_EQ(tape.ToString(), "1");
+    tape.WriteSymbol('1');
+    EXPECT_EQ(tape.ToString(), "11");
+}
+
+TEST(PackedTapeTest, EmptyInitialization) {
+    PackedTape tape("", "1");
+    EXPECT_EQ(tape.GetCurrentSymbol(), '_');
+    EXPECT_EQ(tape.ToString(), "_");
+}
+
+TEST(PackedTapeTest, MiddleBlankCharacter) {
+    PackedTape tape("1_0", "01");
+    EXPECT_EQ(tape.ToString(), "1_0");
+}
+
+TEST(PackedTapeTest, LongRunsAcrossWords) {
+    std::string pattern;
+    for (int i = 0; i < 300; ++i)
+        pattern.push_back(i % 3 == 0 ? '1' : '0');
+    PackedTape tape(pattern, "01");
+    EXPECT_EQ(tape.ToString(), pattern);
+
+    for (int i = 0; i < 500; ++i)
+        tape.MoveLeft();
+    tape.WriteSymbol('1');
+    EXPECT_EQ(tape.ToString(), "1" + std::string(499, '_') + pattern);
+}
+
+TEST(PackedTapeTest, MatchesPlainTapeOnRandomWalk) {
+    PackedTape packed("", "01");
+    std::string expected(1, '_');
+    size_t head = 0;
+    unsigned seed = 12345;
+    for (int i = 0; i < 5000; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        unsigned r = (seed >> 16) % 4;
+        if (r == 0) {
+            char c = ((seed >> 8) & 1) ? '1' : '0';
+            packed.WriteSymbol(c);
+            expected[head] = c;
+        }
+        else if (r == 1) {
+            packed.MoveLeft();
+            if (head == 0)
+                expected.insert(expected.begin(), '_');
+            else
+                --head;
+        }
+        else {
+            packed.MoveRight();
+            if (++head == expected.size())
+                expected.push_back('_');
+        }
+        ASSERT_EQ(packed.GetCurrentSymbol(), expected[head]);
+    }
+    size_t l = expected.find_first_not_of('_');
+    size_t r = expected.find_last_not_of('_');
+    EXPECT_EQ(packed.ToString(), l == std::string::npos ? "_" : expected.substr(l, r - l + 1));
+}
+
+TEST(PackedTapeTest, UsesLessMemory) {
+    PackedTape tape(std::string(6400, '1'), "1");
+    EXPECT_LE(tape.MemoryUsage(), 6400u / 8 + 8);
+}
+
+TEST(PackedTapeTest, HeadPositionIsRelativeToInitialCell) {
+    PackedTape tape("10", "01");
+    EXPECT_EQ(tape.GetHeadPosition(), 0);
+    tape.MoveLeft();
+    tape.MoveLeft();
+    EXPECT_EQ(tape.GetHeadPosition(), -2);
+    tape.MoveRight();
+    tape.MoveRight();
+    tape.MoveRight();
+    EXPECT_EQ(tape.GetHeadPosition(), 1);
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -27,3 +27,12 @@ std::string State::GetNext(char read) const {
 std::string State::GetName() const {
     return name;
 }
+
+std::string State::GetAlphabet() const{
+    std::string alphabet;
+    for (const auto& rule : writeMap){
+        alphabet.push_back(rule.first);
+        alphabet.push_back(rule.second);
+    }
+    return alphabet;
+}
@@ -17,4 +17,5 @@ public:
     char GetMove(char read) const;
     std::string GetNext(char read) const;
     std::string GetName() const;
+    std::string GetAlphabet() const;
 };
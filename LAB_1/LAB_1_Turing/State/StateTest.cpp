@@ -43,6 +43,14 @@ TEST(StateTest, ReplaceTransition) {
     EXPECT_EQ(s.GetNext('x'), "W");
 }
 
+TEST(StateTest, AlphabetListsReadAndWriteSymbols) {
+    State s("S");
+    EXPECT_EQ(s.GetAlphabet(), "");
+    s.AddTransition('0', '1', 'R', "S");
+    s.AddTransition('_', 'x', 'L', "T");
+    EXPECT_EQ(s.GetAlphabet(), "01_x");
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -1,6 +1,6 @@
 #include "Tape.h"
 
-Tape::Tape(const std::string& initial) : headIndex(0){
+Tape::Tape(const std::string& initial) : headIndex(0), origin(0){
     for (char c : initial) 
         cells.push_back(c); 
     if (cells.empty()) 
@@ -18,6 +18,7 @@ void Tape::WriteSymbol(char symbol){
 void Tape::MoveLeft(){
     if (headIndex == 0){           
         cells.push_front(BLANK);       
+        ++origin;
     }
     else{
         --headIndex;            
@@ -48,3 +49,15 @@ std::string Tape::ToString() const{
         out.push_back(cells[i]);
     return out;
 }
+
+size_t Tape::MemoryUsage() const{
+    return cells.size() * sizeof(char);
+}
+
+std::unique_ptr<TapeBase> Tape::Clone() const{
+    return std::make_unique<Tape>(*this);
+}
+
+long long Tape::GetHeadPosition() const{
+    return static_cast<long long>(headIndex) - origin;
+}
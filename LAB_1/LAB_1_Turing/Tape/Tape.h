@@ -1,20 +1,24 @@
 #pragma once
 #include <string>
 #include <deque>
+#include "TapeBase.h"
 
-class Tape{
+class Tape : public TapeBase{
 private:
     std::deque<char> cells;               
     int headIndex;                        
-    static constexpr char BLANK = '_';    
+    int origin;
 
 public:
     Tape() = delete;                      
     explicit Tape(const std::string& initial);
-    char GetCurrentSymbol() const;        
-    void WriteSymbol(char symbol);        
-    void MoveLeft();                      
-    void MoveRight();                     
-    std::string ToString() const;         
+    char GetCurrentSymbol() const override;        
+    void WriteSymbol(char symbol) override;        
+    void MoveLeft() override;                      
+    void MoveRight() override;                     
+    std::string ToString() const override;         
+    size_t MemoryUsage() const override;
+    long long GetHeadPosition() const override;
+    std::unique_ptr<TapeBase> Clone() const override;
     ~Tape() = default;
 };
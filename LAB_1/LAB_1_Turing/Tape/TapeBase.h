@@ -0,0 +1,19 @@
+#pragma once
+#include <string>
+#include <memory>
+#include <cstddef>
+
+class TapeBase{
+public:
+    static constexpr char BLANK = '_';
+
+    virtual char GetCurrentSymbol() const = 0;
+    virtual void WriteSymbol(char symbol) = 0;
+    virtual void MoveLeft() = 0;
+    virtual void MoveRight() = 0;
+    virtual std::string ToString() const = 0;
+    virtual size_t MemoryUsage() const = 0;
+    virtual long long GetHeadPosition() const = 0;
+    virtual std::unique_ptr<TapeBase> Clone() const = 0;
+    virtual ~TapeBase() = default;
+};
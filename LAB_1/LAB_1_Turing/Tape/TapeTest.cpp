@@ -81,6 +81,18 @@ TEST(TapeTest, MiddleBlankCharacter) {
     EXPECT_EQ(tape.ToString(), "AXB");
 }
 
+TEST(TapeTest, HeadPositionIsRelativeToInitialCell) {
+    Tape tape("AB");
+    EXPECT_EQ(tape.GetHeadPosition(), 0);
+    tape.MoveLeft();
+    tape.MoveLeft();
+    EXPECT_EQ(tape.GetHeadPosition(), -2);
+    tape.MoveRight();
+    tape.MoveRight();
+    tape.MoveRight();
+    EXPECT_EQ(tape.GetHeadPosition(), 1);
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -0,0 +1,129 @@
+#include "TransitionTable.h"
+#include <chrono>
+#include <algorithm>
+
+TransitionTable::TransitionTable(const TuringMachineLogic& machine) : startState(HALT), flagged(false){
+    const auto& states = machine.GetStates();
+    for (const auto& state : states){
+        stateIds[state.first] = static_cast<int>(stateNames.size());
+        stateNames.push_back(state.first);
+    }
+
+    table.assign(stateNames.size() * SYMBOLS, Transition{ HALT, 0, 0, 0 });
+    for (const auto& state : states){
+        int id = stateIds[state.first];
+        for (int c = 0; c < SYMBOLS; ++c){
+            char read = static_cast<char>(c);
+            if (!state.second.HasTransition(read))
+                continue;
+            char move = state.second.GetMove(read);
+            Transition& t = table[static_cast<size_t>(id) * SYMBOLS + c];
+            t.next = stateIds[state.second.GetNext(read)];
+            t.write = state.second.GetWrite(read);
+            t.move = static_cast<signed char>(move == 'L' ? -1 : (move == 'R' ? 1 : 0));
+        }
+    }
+
+    startState = GetStateId(machine.GetCurrentState());
+}
+
+const Transition* TransitionTable::Data() const{
+    return table.data();
+}
+
+bool TransitionTable::HasFlags() const{
+    return flagged;
+}
+
+void TransitionTable::SetFlag(int state, char symbol, uint8_t flag){
+    table.at(static_cast<size_t>(state) * SYMBOLS + static_cast<unsigned char>(symbol)).flags |= flag;
+    flagged = true;
+}
+
+void TransitionTable::MarkStateEntry(int state){
+    for (auto& t : table)
+        if (t.next == state)
+            t.flags |= BREAK_ENTRY;
+    flagged = true;
+}
+
+void TransitionTable::ClearFlags(){
+    for (auto& t : table)
+        t.flags = 0;
+    flagged = false;
+}
+
+int TransitionTable::GetStartState() const{
+    return startState;
+}
+
+int TransitionTable::GetStateCount() const{
+    return static_cast<int>(stateNames.size());
+}
+
+int TransitionTable::GetStateId(const std::string& name) const{
+    auto it = stateIds.find(name);
+    return it == stateIds.end() ? HALT : it->second;
+}
+
+const std::string& TransitionTable::GetStateName(int id) const{
+    return stateNames.at(id);
+}
+
+RunResult TransitionTable::Run(int state, TapeBase& tape, const RunLimits& limits, const std::atomic<bool>* cancel,
+    const std::function<void(int)>& onStep) const{
+    auto start = std::chrono::steady_clock::now();
+    long long interval = std::max(1LL, limits.checkInterval);
+
+    RunResult result;
+    bool halted = state == HALT;
+    while (!halted){
+        long long batch = interval;
+        if (limits.maxSteps > 0){
+            if (result.steps >= limits.maxSteps){
+                result.status = RunStatus::StepLimit;
+                break;
+            }
+            batch = std::min(batch, limits.maxSteps - result.steps);
+        }
+
+        for (long long i = 0; i < batch; ++i){
+            const Transition& t = Get(state, tape.GetCurrentSymbol());
+            if (t.next == HALT){
+                halted = true;
+                break;
+            }
+            tape.WriteSymbol(t.write);
+            if (t.move < 0)
+                tape.MoveLeft();
+            else if (t.move > 0)
+                tape.MoveRight();
+            state = t.next;
+            ++result.steps;
+            if (onStep)
+                onStep(state);
+        }
+        if (halted)
+            break;
+
+        if (cancel && cancel->load(std::memory_order_relaxed)){
+            result.status = RunStatus::Cancelled;
+            break;
+        }
+        if (limits.maxTapeBytes > 0 && tape.MemoryUsage() > limits.maxTapeBytes){
+            result.status = RunStatus::MemoryLimit;
+            break;
+        }
+        if (limits.maxMillis > 0){
+            auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+            if (elapsed.count() >= limits.maxMillis){
+                result.status = RunStatus::TimeLimit;
+                break;
+            }
+        }
+    }
+
+    result.state = state == HALT ? std::string() : GetStateName(state);
+    result.tape = tape.ToString();
+    return result;
+}
@@ -0,0 +1,47 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <map>
+#include <cstdint>
+#include <atomic>
+#include <functional>
+#include "../TuringMachineLogic/TuringMachineLogic.h"
+
+struct Transition {
+    int32_t next;
+    char write;
+    signed char move;
+    uint8_t flags;
+};
+
+class TransitionTable{
+private:
+    std::vector<Transition> table;
+    std::vector<std::string> stateNames;
+    std::map<std::string, int> stateIds;
+    int startState;
+    bool flagged;
+
+public:
+    static constexpr int SYMBOLS = 256;
+    static constexpr int32_t HALT = -1;
+    static constexpr uint8_t BREAK_BEFORE = 1;
+    static constexpr uint8_t BREAK_ENTRY = 2;
+
+    explicit TransitionTable(const TuringMachineLogic& machine);
+    const Transition& Get(int state, char symbol) const{
+        return table[static_cast<size_t>(state) * SYMBOLS + static_cast<unsigned char>(symbol)];
+    }
+    const Transition* Data() const;
+    bool HasFlags() const;
+    void SetFlag(int state, char symbol, uint8_t flag);
+    void MarkStateEntry(int state);
+    void ClearFlags();
+    int GetStartState() const;
+    int GetStateCount() const;
+    int GetStateId(const std::string& name) const;
+    const std::string& GetStateName(int id) const;
+    RunResult Run(int state, TapeBase& tape, const RunLimits& limits, const std::atomic<bool>* cancel = nullptr,
+        const std::function<void(int)>& onStep = nullptr) const;
+    ~TransitionTable() = default;
+};
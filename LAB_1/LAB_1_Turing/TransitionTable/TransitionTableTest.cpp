@@ -0,0 +1,45 @@
+#include <gtest/gtest.h>
+#include <fstream>
+#include <cstdio>
+
+#include "TransitionTable.h"
+
+TEST(TransitionTableTest, CompilesRules) {
+    TuringMachineLogic machine;
+    machine.LoadFromString("1\nS0 1 0 R S1\nS1 _ 1 L S0\n");
+    TransitionTable table(machine);
+
+    EXPECT_EQ(table.GetStateCount(), 2);
+    EXPECT_EQ(table.GetStateName(table.GetStartState()), "S0");
+
+    const Transition& t = table.Get(table.GetStateId("S0"), '1');
+    EXPECT_EQ(t.next, table.GetStateId("S1"));
+    EXPECT_EQ(t.write, '0');
+    EXPECT_EQ(t.move, 1);
+
+    const Transition& back = table.Get(table.GetStateId("S1"), '_');
+    EXPECT_EQ(back.move, -1);
+    EXPECT_EQ(back.next, table.GetStateId("S0"));
+}
+
+TEST(TransitionTableTest, MissingRulesHalt) {
+    TuringMachineLogic machine;
+    machine.LoadFromString("1\nS 1 0 R T\n");
+    TransitionTable table(machine);
+    EXPECT_EQ(table.Get(table.GetStateId("S"), '0').next, TransitionTable::HALT);
+    EXPECT_EQ(table.Get(table.GetStateId("T"), '1').next, TransitionTable::HALT);
+    EXPECT_EQ(table.GetStateId("Q"), TransitionTable::HALT);
+}
+
+TEST(TransitionTableTest, NoRulesHasNoStartState) {
+    TuringMachineLogic machine;
+    machine.LoadFromString("001\n");
+    TransitionTable table(machine);
+    EXPECT_EQ(table.GetStartState(), TransitionTable::HALT);
+    EXPECT_EQ(table.GetStateCount(), 0);
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
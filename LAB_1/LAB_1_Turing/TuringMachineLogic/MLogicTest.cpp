@@ -259,6 +259,121 @@ TEST(MLogicTest, ComplexNumericSequence) {
     std::remove(fname.c_str());
 }
 
+TEST(MLogicTest, RunUntilHalt) {
+    std::string fname = "test_run_halt.txt";
+    WriteTempFile(fname, "101\nS 1 0 R S\nS 0 1 R S\n");
+
+    TuringMachineLogic machine;
+    machine.LoadFromFile(fname);
+    RunResult result = machine.Run(RunLimits());
+    EXPECT_EQ(result.status, RunStatus::Halted);
+    EXPECT_EQ(result.steps, 3);
+    EXPECT_EQ(result.state, "S");
+    EXPECT_EQ(result.tape, "010");
+
+    std::remove(fname.c_str());
+}
+
+TEST(MLogicTest, RunStopsAtStepLimit) {
+    TuringMachineLogic machine;
+    machine.LoadFromString("_\nA _ 1 R A\n");
+    RunLimits limits;
+    limits.maxSteps = 10;
+    limits.checkInterval = 3;
+    RunResult result = machine.Run(limits);
+    EXPECT_EQ(result.status, RunStatus::StepLimit);
+    EXPECT_EQ(result.steps, 10);
+    EXPECT_EQ(result.tape, "1111111111");
+}
+
+TEST(MLogicTest, RunStopsAtMemoryLimit) {
+    TuringMachineLogic machine;
+    machine.LoadFromString("_\nA _ 1 R A\n");
+    RunLimits limits;
+    limits.maxTapeBytes = 1000;
+    limits.checkInterval = 64;
+    RunResult result = machine.Run(limits);
+    EXPECT_EQ(result.status, RunStatus::MemoryLimit);
+    EXPECT_GE(result.tape.size(), 1000u);
+    EXPECT_EQ(result.state, "A");
+}
+
+TEST(MLogicTest, RunStopsAtTimeLimit) {
+    TuringMachineLogic machine;
+    machine.LoadFromString("0\nA 0 1 R B\nB _ _ L A\nA 1 0 R B\n");
+    RunLimits limits;
+    limits.maxMillis = 5;
+    RunResult result = machine.Run(limits);
+    EXPECT_EQ(result.status, RunStatus::TimeLimit);
+    EXPECT_GT(result.steps, 0);
+}
+
+TEST(MLogicTest, RunReportsEveryStepAndKeepsLimits) {
+    TuringMachineLogic machine;
+    machine.LoadFromString("_\nA _ 1 R A\n");
+    RunLimits limits;
+    limits.maxTapeBytes = 100;
+    limits.checkInterval = 1;
+    long long calls = 0;
+    std::string last;
+    RunResult result = machine.Run(limits, nullptr, [&](const TuringMachineLogic& m) {
+        ++calls;
+        last = m.GetTapeString();
+    });
+    EXPECT_EQ(result.status, RunStatus::MemoryLimit);
+    EXPECT_EQ(calls, result.steps);
+    EXPECT_EQ(last, result.tape);
+}
+
+TEST(MLogicTest, RunHonoursCancellation) {
+    TuringMachineLogic machine;
+    machine.LoadFromString("_\nA _ 1 R A\n");
+    std::atomic<bool> cancel(true);
+    RunLimits limits;
+    limits.checkInterval = 16;
+    RunResult result = machine.Run(limits, &cancel);
+    EXPECT_EQ(result.status, RunStatus::Cancelled);
+    EXPECT_EQ(result.steps, 16);
+}
+
+
+TEST(MLogicTest, BinaryAlphabetSelectsPackedTape) {
+    TuringMachineLogic machine;
+    machine.LoadFromString("101\nS 1 0 R S\nS 0 1 R S\n");
+    EXPECT_TRUE(machine.UsesPackedTape());
+    EXPECT_EQ(machine.Run(RunLimits()).tape, "010");
+
+    TuringMachineLogic wide;
+    wide.LoadFromString("210\nA 2 3 R B\nB 1 4 R C\nC 0 0 R HALT\n");
+    EXPECT_FALSE(wide.UsesPackedTape());
+    EXPECT_EQ(wide.Run(RunLimits()).tape, "340");
+}
+
+TEST(MLogicTest, CopyKeepsIndependentTape) {
+    TuringMachineLogic machine;
+    machine.LoadFromString("1\nS 1 0 R S\n");
+    TuringMachineLogic copy(machine);
+    EXPECT_TRUE(copy.Step());
+    EXPECT_EQ(copy.GetTapeString(), "0");
+    EXPECT_EQ(machine.GetTapeString(), "1");
+}
+
+TEST(MLogicTest, FileTapeRunMatchesInMemory) {
+    std::string program = "_\nA _ 1 R B\nB _ 0 R A\n";
+    TuringMachineLogic memory;
+    memory.LoadFromString(program);
+    TuringMachineLogic swapped;
+    swapped.LoadFromString(program);
+    swapped.UseFileTape("test_machine_swap.swp", 64, 2);
+
+    RunLimits limits;
+    limits.maxSteps = 1000;
+    RunResult expected = memory.Run(limits);
+    RunResult actual = swapped.Run(limits);
+    EXPECT_EQ(actual.tape, expected.tape);
+    EXPECT_EQ(actual.state, expected.state);
+    EXPECT_LE(swapped.GetTape().MemoryUsage(), 2u * 65536u);
+}
 
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
@@ -1,16 +1,59 @@
 #include "TuringMachineLogic.h"
+#include "../TransitionTable/TransitionTable.h"
 #include <fstream>
 #include <sstream>
 #include <stdexcept>
-
-TuringMachineLogic::TuringMachineLogic() : tape(std::string("")), currentState(""){ }
+#include <algorithm>
+
+TuringMachineLogic::TuringMachineLogic()
+    : tape(std::make_unique<Tape>(std::string(""))), swapPageCells(0), swapResidentPages(0), currentState(""){ }
+
+TuringMachineLogic::TuringMachineLogic(const TuringMachineLogic& other)
+    : tape(other.tape->Clone()), initialTape(other.initialTape), swapPath(other.swapPath.empty() ? std::string() : FileTape::UniquePath(other.swapPath)), swapPageCells(other.swapPageCells),
+      swapResidentPages(other.swapResidentPages), states(other.states), currentState(other.currentState){ }
+
+TuringMachineLogic& TuringMachineLogic::operator=(const TuringMachineLogic& other){
+    if (this != &other){
+        tape = other.tape->Clone();
+        initialTape = other.initialTape;
+        swapPath = other.swapPath.empty() ? std::string() : FileTape::UniquePath(other.swapPath);
+        swapPageCells = other.swapPageCells;
+        swapResidentPages = other.swapResidentPages;
+        states = other.states;
+        currentState = other.currentState;
+    }
+    return *this;
+}
 
 void TuringMachineLogic::EnsureStateExists(const std::string& name){
     states.try_emplace(name, name);
 }
 
 void TuringMachineLogic::ParseInitialTape(const std::string& line){
-    tape = Tape(line);
+    initialTape = line;
+    tape = std::make_unique<Tape>(line);
+}
+
+void TuringMachineLogic::SelectTape(){
+    if (!swapPath.empty()){
+        tape.reset();
+        tape = std::make_unique<FileTape>(initialTape, swapPath, swapPageCells, swapResidentPages);
+        return;
+    }
+    tape = CreateTape(initialTape);
+}
+
+std::unique_ptr<TapeBase> TuringMachineLogic::CreateTape(const std::string& initial) const{
+    if (!swapPath.empty())
+        return std::make_unique<FileTape>(initial, FileTape::UniquePath(swapPath), swapPageCells, swapResidentPages);
+
+    std::string alphabet = initial;
+    for (const auto& state : states)
+        alphabet += state.second.GetAlphabet();
+
+    if (PackedTape::Fits(alphabet))
+        return std::make_unique<PackedTape>(initial, alphabet);
+    return std::make_unique<Tape>(initial);
 }
 
 bool TuringMachineLogic::ParseRuleLine(const std::string& line){
@@ -36,7 +79,27 @@ void TuringMachineLogic::LoadFromFile(const std::string& filename){
     std::ifstream in(filename);
     if (!in) 
         throw std::runtime_error("   : " + filename);
+    LoadFromStream(in);
+}
+
+void TuringMachineLogic::LoadFromString(const std::string& text){
+    std::istringstream in(text);
+    LoadFromStream(in);
+}
+
+void TuringMachineLogic::SetTape(const std::string& initial){
+    ParseInitialTape(initial);
+    SelectTape();
+}
+
+void TuringMachineLogic::UseFileTape(const std::string& scratchPath, size_t pageCells, size_t residentPages){
+    swapPath = scratchPath;
+    swapPageCells = pageCells;
+    swapResidentPages = residentPages;
+    SelectTape();
+}
 
+void TuringMachineLogic::LoadFromStream(std::istream& in){
     std::string line;
     bool initialSet = false;
     bool firstRuleFound = false;
@@ -69,6 +132,7 @@ void TuringMachineLogic::LoadFromFile(const std::string& filename){
             continue;
         }        
     }
+    SelectTape();
 }
 
 bool TuringMachineLogic::Step() {
@@ -79,7 +143,7 @@ bool TuringMachineLogic::Step() {
     if (it == states.end())
         return false;
 
-    char cur = tape.GetCurrentSymbol();
+    char cur = tape->GetCurrentSymbol();
 
     if (!it->second.HasTransition(cur))
         return false;
@@ -88,20 +152,57 @@ bool TuringMachineLogic::Step() {
     char move = it->second.GetMove(cur);
     std::string next = it->second.GetNext(cur);
 
-    tape.WriteSymbol(write);
+    tape->WriteSymbol(write);
 
     if (move == 'L')
-        tape.MoveLeft();
+        tape->MoveLeft();
     else if (move == 'R')
-        tape.MoveRight();
+        tape->MoveRight();
 
     currentState = next;
     return true;
 }
 
+RunResult TuringMachineLogic::Run(const RunLimits& limits, const std::atomic<bool>* cancel,
+    const std::function<void(const TuringMachineLogic&)>& onStep){
+    TransitionTable table(*this);
+    std::function<void(int)> report;
+    if (onStep)
+        report = [&](int state){
+            currentState = table.GetStateName(state);
+            onStep(*this);
+        };
+    RunResult result = table.Run(table.GetStateId(currentState), *tape, limits, cancel, report);
+    currentState = result.state;
+    return result;
+}
+
+const char* TuringMachineLogic::StatusName(RunStatus status){
+    switch (status){
+    case RunStatus::Halted: return "HALTED";
+    case RunStatus::StepLimit: return "STEP_LIMIT";
+    case RunStatus::TimeLimit: return "TIME_LIMIT";
+    case RunStatus::MemoryLimit: return "MEMORY_LIMIT";
+    case RunStatus::Cancelled: return "CANCELLED";
+    }
+    return "UNKNOWN";
+}
+
 std::string TuringMachineLogic::GetCurrentState() const{
     return currentState; 
 } 
 std::string TuringMachineLogic::GetTapeString() const{
-    return tape.ToString(); 
+    return tape->ToString(); 
+}
+
+bool TuringMachineLogic::UsesPackedTape() const{
+    return dynamic_cast<const PackedTape*>(tape.get()) != nullptr;
+}
+
+const std::map<std::string, State>& TuringMachineLogic::GetStates() const{
+    return states;
+}
+
+const TapeBase& TuringMachineLogic::GetTape() const{
+    return *tape;
 }
@@ -1,12 +1,39 @@
 #pragma once
 #include <string>
 #include <map>
+#include <memory>
+#include <istream>
+#include <atomic>
+#include <functional>
+#include <cstddef>
 #include "../State/State.h"
 #include "../Tape/Tape.h"
+#include "../PackedTape/PackedTape.h"
+#include "../FileTape/FileTape.h"
+
+enum class RunStatus { Halted, StepLimit, TimeLimit, MemoryLimit, Cancelled };
+
+struct RunLimits {
+    long long maxSteps = 0;
+    long long maxMillis = 0;
+    size_t maxTapeBytes = 0;
+    long long checkInterval = 4096;
+};
+
+struct RunResult {
+    RunStatus status = RunStatus::Halted;
+    long long steps = 0;
+    std::string state;
+    std::string tape;
+};
 
 class TuringMachineLogic {
 private:
-    Tape tape;                       
+    std::unique_ptr<TapeBase> tape;
+    std::string initialTape;
+    std::string swapPath;
+    size_t swapPageCells;
+    size_t swapResidentPages;
     std::map<std::string, State> states; 
     std::string currentState;        
 
@@ -14,12 +41,26 @@ private:
     void EnsureStateExists(const std::string& name);               
     bool ParseRuleLine(const std::string& line);                  
     void ParseInitialTape(const std::string& line);               
+    void SelectTape();
 
 public:
     TuringMachineLogic();
+    TuringMachineLogic(const TuringMachineLogic& other);
+    TuringMachineLogic& operator=(const TuringMachineLogic& other);
     void LoadFromFile(const std::string& filename); 
+    void LoadFromStream(std::istream& in);
+    void LoadFromString(const std::string& text);
+    void SetTape(const std::string& initial);
+    std::unique_ptr<TapeBase> CreateTape(const std::string& initial) const;
+    void UseFileTape(const std::string& scratchPath, size_t pageCells = 65536, size_t residentPages = 64);
     bool Step();                     
+    RunResult Run(const RunLimits& limits, const std::atomic<bool>* cancel = nullptr,
+        const std::function<void(const TuringMachineLogic&)>& onStep = nullptr);
     std::string GetCurrentState() const; 
     std::string GetTapeString() const;
+    bool UsesPackedTape() const;
+    const std::map<std::string, State>& GetStates() const;
+    const TapeBase& GetTape() const;
+    static const char* StatusName(RunStatus status);
     ~TuringMachineLogic() = default;
 };
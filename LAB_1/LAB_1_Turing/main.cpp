@@ -1,17 +1,40 @@
 ﻿#include <iostream>
 #include "TuringMachineLogic/TuringMachineLogic.h"
+#include "JobServer/JobServer.h"
+#include "Debugger/Debugger.h"
+#include <vector>
 #include <windows.h>
+#include <io.h>
+#include <fcntl.h>
+#include <atomic>
+#include <functional>
+#include <chrono>
+
+static std::atomic<bool> interrupted(false);
+
+static BOOL WINAPI OnConsoleCtrl(DWORD type){
+    if (type == CTRL_C_EVENT || type == CTRL_BREAK_EVENT){
+        interrupted = true;
+        return TRUE;
+    }
+    return FALSE;
+}
 
 int main(int argc, char* argv[]){
     SetConsoleCP(1251);
     SetConsoleOutputCP(1251);
     if (argc < 2){
-        std::cerr << "Использование: " << argv[0] << " путь_к_файлу [-log]\n"; 
+        std::cerr << "Использование: " << argv[0] << " путь_к_файлу [-log] [-steps N] [-time мс] [-mem байт] [-break состояние] [-swap файл] | -serve [-threads N]\n"; 
         return 1;
     }
 
     std::string filePath;
     bool logMode = false;
+    bool serveMode = false;
+    unsigned threads = 0;
+    RunLimits limits;
+    std::vector<std::string> breakStates;
+    std::string swapPath;
     for (int i = 1; i < argc; ++i){
         std::string a = argv[i];
 
@@ -20,9 +43,53 @@ int main(int argc, char* argv[]){
             continue; 
         } 
 
+        if (a == "-serve"){
+            serveMode = true;
+            continue;
+        }
+
+        if (a == "-threads" && i + 1 < argc){
+            threads = static_cast<unsigned>(std::stoul(argv[++i]));
+            continue;
+        }
+
+        if (a == "-steps" && i + 1 < argc){
+            limits.maxSteps = std::stoll(argv[++i]);
+            continue;
+        }
+
+        if (a == "-time" && i + 1 < argc){
+            limits.maxMillis = std::stoll(argv[++i]);
+            continue;
+        }
+
+        if (a == "-mem" && i + 1 < argc){
+            limits.maxTapeBytes = static_cast<size_t>(std::stoull(argv[++i]));
+            continue;
+        }
+
+        if (a == "-break" && i + 1 < argc){
+            breakStates.push_back(argv[++i]);
+            continue;
+        }
+
+        if (a == "-swap" && i + 1 < argc){
+            swapPath = argv[++i];
+            continue;
+        }
+
         if (filePath.empty()) filePath = a;            
     }
 
+    if (serveMode){
+        _setmode(_fileno(stdin), _O_BINARY);
+        _setmode(_fileno(stdout), _O_BINARY);
+        std::ios::sync_with_stdio(false);
+        JobServer server(std::cout, threads, limits);
+        server.Serve(std::cin);
+        return 0;
+    }
+
     if (filePath.empty()){
         std::cerr << "Ошибка: не указан путь к файлу\n";
         return 1;
@@ -32,23 +99,77 @@ int main(int argc, char* argv[]){
 
     try{
         machine.LoadFromFile(filePath);      
+        if (!swapPath.empty())
+            machine.UseFileTape(swapPath);
     }
     catch (const std::exception& ex){
         std::cerr << "Ошибка загрузки: " << ex.what() << "\n";
         return 1;
     }
 
-    while (machine.Step()){
-        if (logMode){
-            std::cout << "Состояние: " << machine.GetCurrentState()
-            << ", Лента: " << machine.GetTapeString() << '\n';
+    SetConsoleCtrlHandler(OnConsoleCtrl, TRUE);
+
+    if (!breakStates.empty()){
+        Debugger debugger(machine);
+        try{
+            for (const auto& name : breakStates)
+                debugger.BreakOnStateEntry(name);
+        }
+        catch (const std::exception& ex){
+            std::cerr << "Ошибка: " << ex.what() << "\n";
+            return 1;
+        }
+
+        // Пределы действуют на весь прогон, поэтому каждый отрезок до точки останова получает остаток шагов и времени
+        auto start = std::chrono::steady_clock::now();
+        StopReason reason = StopReason::Halted;
+        for (;;){
+            RunLimits left = limits;
+            if (limits.maxSteps > 0){
+                left.maxSteps = limits.maxSteps - debugger.GetSteps();
+                if (left.maxSteps <= 0){
+                    reason = StopReason::StepLimit;
+                    break;
+                }
+            }
+            if (limits.maxMillis > 0){
+                auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+                left.maxMillis = limits.maxMillis - elapsed.count();
+                if (left.maxMillis <= 0){
+                    reason = StopReason::TimeLimit;
+                    break;
+                }
+            }
+            reason = debugger.Run(left, &interrupted);
+            if (reason != StopReason::StateEntry)
+                break;
+            std::cout << "Точка останова (шаг " << debugger.GetSteps() << "): " << debugger.GetCurrentState()
+                << ", Позиция: " << debugger.GetHeadPosition() << ", Лента: " << debugger.GetTapeString() << '\n';
         }
+        if (reason != StopReason::Halted)
+            std::cout << "Выполнение прервано (" << Debugger::ReasonName(reason)
+                << ") после " << debugger.GetSteps() << " шагов" << std::endl;
+        std::cout << "Итоговое Состояние: " << debugger.GetCurrentState() << std::endl;
+        std::cout << "Итоговая лента:  " << debugger.GetTapeString() << std::endl;
+        return 0;
     }
 
-    if (!logMode) {
-        std::cout << "Итоговое Состояние: " << machine.GetCurrentState() << std::endl;
-        std::cout << "Итоговая лента:  " << machine.GetTapeString() << std::endl;
+    // В режиме -log каждый шаг печатается из Run, поэтому пределы проверяются после каждого шага
+    std::function<void(const TuringMachineLogic&)> logStep;
+    if (logMode){
+        limits.checkInterval = 1;
+        logStep = [](const TuringMachineLogic& m){
+            std::cout << "Состояние: " << m.GetCurrentState()
+            << ", Лента: " << m.GetTapeString() << '\n';
+        };
     }
 
+    RunResult result = machine.Run(limits, &interrupted, logStep);
+    if (result.status != RunStatus::Halted)
+        std::cout << "Выполнение прервано (" << TuringMachineLogic::StatusName(result.status)
+            << ") после " << result.steps << " шагов" << std::endl;
+    std::cout << "Итоговое Состояние: " << result.state << std::endl;
+    std::cout << "Итоговая лента:  " << result.tape << std::endl;
+
     return 0;
 }